@@ -22,6 +22,21 @@
 #    define CANARD_PRIVATE static
 #endif
 
+/// Selects the transfer CRC implementation; all of them compute the same CRC-16/CCITT-FALSE:
+///     CANARD_CRC_BITWISE -- bit by bit, no tables. This is the default as it is the smallest.
+///     CANARD_CRC_TABLE   -- one byte at a time through a 512-byte table.
+///     CANARD_CRC_SLICE8  -- eight bytes at a time through eight tables, 4 KiB in total.
+///     CANARD_CRC_CLMUL   -- carry-less multiplication (x86 PCLMUL or ARMv8 PMULL) for long inputs and slicing-by-8
+///                           otherwise; the instructions are used only if the CPU is found to support them at startup.
+///                           PMULL is used only when the build targets the ARMv8 cryptography extension.
+#define CANARD_CRC_BITWISE 0
+#define CANARD_CRC_TABLE 1
+#define CANARD_CRC_SLICE8 2
+#define CANARD_CRC_CLMUL 3
+#ifndef CANARD_CONFIG_CRC
+#    define CANARD_CONFIG_CRC CANARD_CRC_BITWISE
+#endif
+
 #if !defined(__STDC_VERSION__) || (__STDC_VERSION__ < 199901L)
 #    error "Unsupported language: ISO C99 or a newer version is required."
 #endif
@@ -62,13 +77,14 @@ typedef uint16_t TransferCRC;
 #define CRC_RESIDUE 0x0000U
 #define CRC_SIZE_BYTES 2U
 
+#if CANARD_CONFIG_CRC == CANARD_CRC_BITWISE
+
 CANARD_PRIVATE TransferCRC crcAddByte(const TransferCRC crc, const uint8_t byte);
 CANARD_PRIVATE TransferCRC crcAddByte(const TransferCRC crc, const uint8_t byte)
 {
     static const TransferCRC Top  = 0x8000U;
     static const TransferCRC Poly = 0x1021U;
     TransferCRC              out  = crc ^ (uint16_t)((uint16_t)(byte) << BITS_PER_BYTE);
-    // Consider adding a compilation option that replaces this with a CRC table. Adds 512 bytes of ROM.
     // Do not fold this into a loop because a size-optimizing compiler won't unroll it degrading the performance.
     out = (uint16_t)((uint16_t)(out << 1U) ^ (((out & Top) != 0U) ? Poly : 0U));
     out = (uint16_t)((uint16_t)(out << 1U) ^ (((out & Top) != 0U) ? Poly : 0U));
@@ -95,18 +111,457 @@ CANARD_PRIVATE TransferCRC crcAdd(const TransferCRC crc, const size_t size, cons
     return out;
 }
 
+#else
+
+/// CRCTable[k][i] is the CRC of the byte i followed by k zero bytes, i.e., i * x^(16 + 8k) mod P.
+/// The first row alone drives the byte-wise loop (512 bytes of ROM); slicing-by-8 adds the other seven (4 KiB).
+#    if CANARD_CONFIG_CRC == CANARD_CRC_TABLE
+#        define CRC_TABLE_ROWS 1U
+#    else
+#        define CRC_TABLE_ROWS 8U
+#    endif
+static const TransferCRC CRCTable[CRC_TABLE_ROWS][256] = {
+    {
+        0x0000U, 0x1021U, 0x2042U, 0x3063U, 0x4084U, 0x50A5U, 0x60C6U, 0x70E7U,
+        0x8108U, 0x9129U, 0xA14AU, 0xB16BU, 0xC18CU, 0xD1ADU, 0xE1CEU, 0xF1EFU,
+        0x1231U, 0x0210U, 0x3273U, 0x2252U, 0x52B5U, 0x4294U, 0x72F7U, 0x62D6U,
+        0x9339U, 0x8318U, 0xB37BU, 0xA35AU, 0xD3BDU, 0xC39CU, 0xF3FFU, 0xE3DEU,
+        0x2462U, 0x3443U, 0x0420U, 0x1401U, 0x64E6U, 0x74C7U, 0x44A4U, 0x5485U,
+        0xA56AU, 0xB54BU, 0x8528U, 0x9509U, 0xE5EEU, 0xF5CFU, 0xC5ACU, 0xD58DU,
+        0x3653U, 0x2672U, 0x1611U, 0x0630U, 0x76D7U, 0x66F6U, 0x5695U, 0x46B4U,
+        0xB75BU, 0xA77AU, 0x9719U, 0x8738U, 0xF7DFU, 0xE7FEU, 0xD79DU, 0xC7BCU,
+        0x48C4U, 0x58E5U, 0x6886U, 0x78A7U, 0x0840U, 0x1861U, 0x2802U, 0x3823U,
+        0xC9CCU, 0xD9EDU, 0xE98EU, 0xF9AFU, 0x8948U, 0x9969U, 0xA90AU, 0xB92BU,
+        0x5AF5U, 0x4AD4U, 0x7AB7U, 0x6A96U, 0x1A71U, 0x0A50U, 0x3A33U, 0x2A12U,
+        0xDBFDU, 0xCBDCU, 0xFBBFU, 0xEB9EU, 0x9B79U, 0x8B58U, 0xBB3BU, 0xAB1AU,
+        0x6CA6U, 0x7C87U, 0x4CE4U, 0x5CC5U, 0x2C22U, 0x3C03U, 0x0C60U, 0x1C41U,
+        0xEDAEU, 0xFD8FU, 0xCDECU, 0xDDCDU, 0xAD2AU, 0xBD0BU, 0x8D68U, 0x9D49U,
+        0x7E97U, 0x6EB6U, 0x5ED5U, 0x4EF4U, 0x3E13U, 0x2E32U, 0x1E51U, 0x0E70U,
+        0xFF9FU, 0xEFBEU, 0xDFDDU, 0xCFFCU, 0xBF1BU, 0xAF3AU, 0x9F59U, 0x8F78U,
+        0x9188U, 0x81A9U, 0xB1CAU, 0xA1EBU, 0xD10CU, 0xC12DU, 0xF14EU, 0xE16FU,
+        0x1080U, 0x00A1U, 0x30C2U, 0x20E3U, 0x5004U, 0x4025U, 0x7046U, 0x6067U,
+        0x83B9U, 0x9398U, 0xA3FBU, 0xB3DAU, 0xC33DU, 0xD31CU, 0xE37FU, 0xF35EU,
+        0x02B1U, 0x1290U, 0x22F3U, 0x32D2U, 0x4235U, 0x5214U, 0x6277U, 0x7256U,
+        0xB5EAU, 0xA5CBU, 0x95A8U, 0x8589U, 0xF56EU, 0xE54FU, 0xD52CU, 0xC50DU,
+        0x34E2U, 0x24C3U, 0x14A0U, 0x0481U, 0x7466U, 0x6447U, 0x5424U, 0x4405U,
+        0xA7DBU, 0xB7FAU, 0x8799U, 0x97B8U, 0xE75FU, 0xF77EU, 0xC71DU, 0xD73CU,
+        0x26D3U, 0x36F2U, 0x0691U, 0x16B0U, 0x6657U, 0x7676U, 0x4615U, 0x5634U,
+        0xD94CU, 0xC96DU, 0xF90EU, 0xE92FU, 0x99C8U, 0x89E9U, 0xB98AU, 0xA9ABU,
+        0x5844U, 0x4865U, 0x7806U, 0x6827U, 0x18C0U, 0x08E1U, 0x3882U, 0x28A3U,
+        0xCB7DU, 0xDB5CU, 0xEB3FU, 0xFB1EU, 0x8BF9U, 0x9BD8U, 0xABBBU, 0xBB9AU,
+        0x4A75U, 0x5A54U, 0x6A37U, 0x7A16U, 0x0AF1U, 0x1AD0U, 0x2AB3U, 0x3A92U,
+        0xFD2EU, 0xED0FU, 0xDD6CU, 0xCD4DU, 0xBDAAU, 0xAD8BU, 0x9DE8U, 0x8DC9U,
+        0x7C26U, 0x6C07U, 0x5C64U, 0x4C45U, 0x3CA2U, 0x2C83U, 0x1CE0U, 0x0CC1U,
+        0xEF1FU, 0xFF3EU, 0xCF5DU, 0xDF7CU, 0xAF9BU, 0xBFBAU, 0x8FD9U, 0x9FF8U,
+        0x6E17U, 0x7E36U, 0x4E55U, 0x5E74U, 0x2E93U, 0x3EB2U, 0x0ED1U, 0x1EF0U,
+    },
+#        if CRC_TABLE_ROWS > 1
+    {
+        0x0000U, 0x3331U, 0x6662U, 0x5553U, 0xCCC4U, 0xFFF5U, 0xAAA6U, 0x9997U,
+        0x89A9U, 0xBA98U, 0xEFCBU, 0xDCFAU, 0x456DU, 0x765CU, 0x230FU, 0x103EU,
+        0x0373U, 0x3042U, 0x6511U, 0x5620U, 0xCFB7U, 0xFC86U, 0xA9D5U, 0x9AE4U,
+        0x8ADAU, 0xB9EBU, 0xECB8U, 0xDF89U, 0x461EU, 0x752FU, 0x207CU, 0x134DU,
+        0x06E6U, 0x35D7U, 0x6084U, 0x53B5U, 0xCA22U, 0xF913U, 0xAC40U, 0x9F71U,
+        0x8F4FU, 0xBC7EU, 0xE92DU, 0xDA1CU, 0x438BU, 0x70BAU, 0x25E9U, 0x16D8U,
+        0x0595U, 0x36A4U, 0x63F7U, 0x50C6U, 0xC951U, 0xFA60U, 0xAF33U, 0x9C02U,
+        0x8C3CU, 0xBF0DU, 0xEA5EU, 0xD96FU, 0x40F8U, 0x73C9U, 0x269AU, 0x15ABU,
+        0x0DCCU, 0x3EFDU, 0x6BAEU, 0x589FU, 0xC108U, 0xF239U, 0xA76AU, 0x945BU,
+        0x8465U, 0xB754U, 0xE207U, 0xD136U, 0x48A1U, 0x7B90U, 0x2EC3U, 0x1DF2U,
+        0x0EBFU, 0x3D8EU, 0x68DDU, 0x5BECU, 0xC27BU, 0xF14AU, 0xA419U, 0x9728U,
+        0x8716U, 0xB427U, 0xE174U, 0xD245U, 0x4BD2U, 0x78E3U, 0x2DB0U, 0x1E81U,
+        0x0B2AU, 0x381BU, 0x6D48U, 0x5E79U, 0xC7EEU, 0xF4DFU, 0xA18CU, 0x92BDU,
+        0x8283U, 0xB1B2U, 0xE4E1U, 0xD7D0U, 0x4E47U, 0x7D76U, 0x2825U, 0x1B14U,
+        0x0859U, 0x3B68U, 0x6E3BU, 0x5D0AU, 0xC49DU, 0xF7ACU, 0xA2FFU, 0x91CEU,
+        0x81F0U, 0xB2C1U, 0xE792U, 0xD4A3U, 0x4D34U, 0x7E05U, 0x2B56U, 0x1867U,
+        0x1B98U, 0x28A9U, 0x7DFAU, 0x4ECBU, 0xD75CU, 0xE46DU, 0xB13EU, 0x820FU,
+        0x9231U, 0xA100U, 0xF453U, 0xC762U, 0x5EF5U, 0x6DC4U, 0x3897U, 0x0BA6U,
+        0x18EBU, 0x2BDAU, 0x7E89U, 0x4DB8U, 0xD42FU, 0xE71EU, 0xB24DU, 0x817CU,
+        0x9142U, 0xA273U, 0xF720U, 0xC411U, 0x5D86U, 0x6EB7U, 0x3BE4U, 0x08D5U,
+        0x1D7EU, 0x2E4FU, 0x7B1CU, 0x482DU, 0xD1BAU, 0xE28BU, 0xB7D8U, 0x84E9U,
+        0x94D7U, 0xA7E6U, 0xF2B5U, 0xC184U, 0x5813U, 0x6B22U, 0x3E71U, 0x0D40U,
+        0x1E0DU, 0x2D3CU, 0x786FU, 0x4B5EU, 0xD2C9U, 0xE1F8U, 0xB4ABU, 0x879AU,
+        0x97A4U, 0xA495U, 0xF1C6U, 0xC2F7U, 0x5B60U, 0x6851U, 0x3D02U, 0x0E33U,
+        0x1654U, 0x2565U, 0x7036U, 0x4307U, 0xDA90U, 0xE9A1U, 0xBCF2U, 0x8FC3U,
+        0x9FFDU, 0xACCCU, 0xF99FU, 0xCAAEU, 0x5339U, 0x6008U, 0x355BU, 0x066AU,
+        0x1527U, 0x2616U, 0x7345U, 0x4074U, 0xD9E3U, 0xEAD2U, 0xBF81U, 0x8CB0U,
+        0x9C8EU, 0xAFBFU, 0xFAECU, 0xC9DDU, 0x504AU, 0x637BU, 0x3628U, 0x0519U,
+        0x10B2U, 0x2383U, 0x76D0U, 0x45E1U, 0xDC76U, 0xEF47U, 0xBA14U, 0x8925U,
+        0x991BU, 0xAA2AU, 0xFF79U, 0xCC48U, 0x55DFU, 0x66EEU, 0x33BDU, 0x008CU,
+        0x13C1U, 0x20F0U, 0x75A3U, 0x4692U, 0xDF05U, 0xEC34U, 0xB967U, 0x8A56U,
+        0x9A68U, 0xA959U, 0xFC0AU, 0xCF3BU, 0x56ACU, 0x659DU, 0x30CEU, 0x03FFU,
+    },
+    {
+        0x0000U, 0x3730U, 0x6E60U, 0x5950U, 0xDCC0U, 0xEBF0U, 0xB2A0U, 0x8590U,
+        0xA9A1U, 0x9E91U, 0xC7C1U, 0xF0F1U, 0x7561U, 0x4251U, 0x1B01U, 0x2C31U,
+        0x4363U, 0x7453U, 0x2D03U, 0x1A33U, 0x9FA3U, 0xA893U, 0xF1C3U, 0xC6F3U,
+        0xEAC2U, 0xDDF2U, 0x84A2U, 0xB392U, 0x3602U, 0x0132U, 0x5862U, 0x6F52U,
+        0x86C6U, 0xB1F6U, 0xE8A6U, 0xDF96U, 0x5A06U, 0x6D36U, 0x3466U, 0x0356U,
+        0x2F67U, 0x1857U, 0x4107U, 0x7637U, 0xF3A7U, 0xC497U, 0x9DC7U, 0xAAF7U,
+        0xC5A5U, 0xF295U, 0xABC5U, 0x9CF5U, 0x1965U, 0x2E55U, 0x7705U, 0x4035U,
+        0x6C04U, 0x5B34U, 0x0264U, 0x3554U, 0xB0C4U, 0x87F4U, 0xDEA4U, 0xE994U,
+        0x1DADU, 0x2A9DU, 0x73CDU, 0x44FDU, 0xC16DU, 0xF65DU, 0xAF0DU, 0x983DU,
+        0xB40CU, 0x833CU, 0xDA6CU, 0xED5CU, 0x68CCU, 0x5FFCU, 0x06ACU, 0x319CU,
+        0x5ECEU, 0x69FEU, 0x30AEU, 0x079EU, 0x820EU, 0xB53EU, 0xEC6EU, 0xDB5EU,
+        0xF76FU, 0xC05FU, 0x990FU, 0xAE3FU, 0x2BAFU, 0x1C9FU, 0x45CFU, 0x72FFU,
+        0x9B6BU, 0xAC5BU, 0xF50BU, 0xC23BU, 0x47ABU, 0x709BU, 0x29CBU, 0x1EFBU,
+        0x32CAU, 0x05FAU, 0x5CAAU, 0x6B9AU, 0xEE0AU, 0xD93AU, 0x806AU, 0xB75AU,
+        0xD808U, 0xEF38U, 0xB668U, 0x8158U, 0x04C8U, 0x33F8U, 0x6AA8U, 0x5D98U,
+        0x71A9U, 0x4699U, 0x1FC9U, 0x28F9U, 0xAD69U, 0x9A59U, 0xC309U, 0xF439U,
+        0x3B5AU, 0x0C6AU, 0x553AU, 0x620AU, 0xE79AU, 0xD0AAU, 0x89FAU, 0xBECAU,
+        0x92FBU, 0xA5CBU, 0xFC9BU, 0xCBABU, 0x4E3BU, 0x790BU, 0x205BU, 0x176BU,
+        0x7839U, 0x4F09U, 0x1659U, 0x2169U, 0xA4F9U, 0x93C9U, 0xCA99U, 0xFDA9U,
+        0xD198U, 0xE6A8U, 0xBFF8U, 0x88C8U, 0x0D58U, 0x3A68U, 0x6338U, 0x5408U,
+        0xBD9CU, 0x8AACU, 0xD3FCU, 0xE4CCU, 0x615CU, 0x566CU, 0x0F3CU, 0x380CU,
+        0x143DU, 0x230DU, 0x7A5DU, 0x4D6DU, 0xC8FDU, 0xFFCDU, 0xA69DU, 0x91ADU,
+        0xFEFFU, 0xC9CFU, 0x909FU, 0xA7AFU, 0x223FU, 0x150FU, 0x4C5FU, 0x7B6FU,
+        0x575EU, 0x606EU, 0x393EU, 0x0E0EU, 0x8B9EU, 0xBCAEU, 0xE5FEU, 0xD2CEU,
+        0x26F7U, 0x11C7U, 0x4897U, 0x7FA7U, 0xFA37U, 0xCD07U, 0x9457U, 0xA367U,
+        0x8F56U, 0xB866U, 0xE136U, 0xD606U, 0x5396U, 0x64A6U, 0x3DF6U, 0x0AC6U,
+        0x6594U, 0x52A4U, 0x0BF4U, 0x3CC4U, 0xB954U, 0x8E64U, 0xD734U, 0xE004U,
+        0xCC35U, 0xFB05U, 0xA255U, 0x9565U, 0x10F5U, 0x27C5U, 0x7E95U, 0x49A5U,
+        0xA031U, 0x9701U, 0xCE51U, 0xF961U, 0x7CF1U, 0x4BC1U, 0x1291U, 0x25A1U,
+        0x0990U, 0x3EA0U, 0x67F0U, 0x50C0U, 0xD550U, 0xE260U, 0xBB30U, 0x8C00U,
+        0xE352U, 0xD462U, 0x8D32U, 0xBA02U, 0x3F92U, 0x08A2U, 0x51F2U, 0x66C2U,
+        0x4AF3U, 0x7DC3U, 0x2493U, 0x13A3U, 0x9633U, 0xA103U, 0xF853U, 0xCF63U,
+    },
+    {
+        0x0000U, 0x76B4U, 0xED68U, 0x9BDCU, 0xCAF1U, 0xBC45U, 0x2799U, 0x512DU,
+        0x85C3U, 0xF377U, 0x68ABU, 0x1E1FU, 0x4F32U, 0x3986U, 0xA25AU, 0xD4EEU,
+        0x1BA7U, 0x6D13U, 0xF6CFU, 0x807BU, 0xD156U, 0xA7E2U, 0x3C3EU, 0x4A8AU,
+        0x9E64U, 0xE8D0U, 0x730CU, 0x05B8U, 0x5495U, 0x2221U, 0xB9FDU, 0xCF49U,
+        0x374EU, 0x41FAU, 0xDA26U, 0xAC92U, 0xFDBFU, 0x8B0BU, 0x10D7U, 0x6663U,
+        0xB28DU, 0xC439U, 0x5FE5U, 0x2951U, 0x787CU, 0x0EC8U, 0x9514U, 0xE3A0U,
+        0x2CE9U, 0x5A5DU, 0xC181U, 0xB735U, 0xE618U, 0x90ACU, 0x0B70U, 0x7DC4U,
+        0xA92AU, 0xDF9EU, 0x4442U, 0x32F6U, 0x63DBU, 0x156FU, 0x8EB3U, 0xF807U,
+        0x6E9CU, 0x1828U, 0x83F4U, 0xF540U, 0xA46DU, 0xD2D9U, 0x4905U, 0x3FB1U,
+        0xEB5FU, 0x9DEBU, 0x0637U, 0x7083U, 0x21AEU, 0x571AU, 0xCCC6U, 0xBA72U,
+        0x753BU, 0x038FU, 0x9853U, 0xEEE7U, 0xBFCAU, 0xC97EU, 0x52A2U, 0x2416U,
+        0xF0F8U, 0x864CU, 0x1D90U, 0x6B24U, 0x3A09U, 0x4CBDU, 0xD761U, 0xA1D5U,
+        0x59D2U, 0x2F66U, 0xB4BAU, 0xC20EU, 0x9323U, 0xE597U, 0x7E4BU, 0x08FFU,
+        0xDC11U, 0xAAA5U, 0x3179U, 0x47CDU, 0x16E0U, 0x6054U, 0xFB88U, 0x8D3CU,
+        0x4275U, 0x34C1U, 0xAF1DU, 0xD9A9U, 0x8884U, 0xFE30U, 0x65ECU, 0x1358U,
+        0xC7B6U, 0xB102U, 0x2ADEU, 0x5C6AU, 0x0D47U, 0x7BF3U, 0xE02FU, 0x969BU,
+        0xDD38U, 0xAB8CU, 0x3050U, 0x46E4U, 0x17C9U, 0x617DU, 0xFAA1U, 0x8C15U,
+        0x58FBU, 0x2E4FU, 0xB593U, 0xC327U, 0x920AU, 0xE4BEU, 0x7F62U, 0x09D6U,
+        0xC69FU, 0xB02BU, 0x2BF7U, 0x5D43U, 0x0C6EU, 0x7ADAU, 0xE106U, 0x97B2U,
+        0x435CU, 0x35E8U, 0xAE34U, 0xD880U, 0x89ADU, 0xFF19U, 0x64C5U, 0x1271U,
+        0xEA76U, 0x9CC2U, 0x071EU, 0x71AAU, 0x2087U, 0x5633U, 0xCDEFU, 0xBB5BU,
+        0x6FB5U, 0x1901U, 0x82DDU, 0xF469U, 0xA544U, 0xD3F0U, 0x482CU, 0x3E98U,
+        0xF1D1U, 0x8765U, 0x1CB9U, 0x6A0DU, 0x3B20U, 0x4D94U, 0xD648U, 0xA0FCU,
+        0x7412U, 0x02A6U, 0x997AU, 0xEFCEU, 0xBEE3U, 0xC857U, 0x538BU, 0x253FU,
+        0xB3A4U, 0xC510U, 0x5ECCU, 0x2878U, 0x7955U, 0x0FE1U, 0x943DU, 0xE289U,
+        0x3667U, 0x40D3U, 0xDB0FU, 0xADBBU, 0xFC96U, 0x8A22U, 0x11FEU, 0x674AU,
+        0xA803U, 0xDEB7U, 0x456BU, 0x33DFU, 0x62F2U, 0x1446U, 0x8F9AU, 0xF92EU,
+        0x2DC0U, 0x5B74U, 0xC0A8U, 0xB61CU, 0xE731U, 0x9185U, 0x0A59U, 0x7CEDU,
+        0x84EAU, 0xF25EU, 0x6982U, 0x1F36U, 0x4E1BU, 0x38AFU, 0xA373U, 0xD5C7U,
+        0x0129U, 0x779DU, 0xEC41U, 0x9AF5U, 0xCBD8U, 0xBD6CU, 0x26B0U, 0x5004U,
+        0x9F4DU, 0xE9F9U, 0x7225U, 0x0491U, 0x55BCU, 0x2308U, 0xB8D4U, 0xCE60U,
+        0x1A8EU, 0x6C3AU, 0xF7E6U, 0x8152U, 0xD07FU, 0xA6CBU, 0x3D17U, 0x4BA3U,
+    },
+    {
+        0x0000U, 0xAA51U, 0x4483U, 0xEED2U, 0x8906U, 0x2357U, 0xCD85U, 0x67D4U,
+        0x022DU, 0xA87CU, 0x46AEU, 0xECFFU, 0x8B2BU, 0x217AU, 0xCFA8U, 0x65F9U,
+        0x045AU, 0xAE0BU, 0x40D9U, 0xEA88U, 0x8D5CU, 0x270DU, 0xC9DFU, 0x638EU,
+        0x0677U, 0xAC26U, 0x42F4U, 0xE8A5U, 0x8F71U, 0x2520U, 0xCBF2U, 0x61A3U,
+        0x08B4U, 0xA2E5U, 0x4C37U, 0xE666U, 0x81B2U, 0x2BE3U, 0xC531U, 0x6F60U,
+        0x0A99U, 0xA0C8U, 0x4E1AU, 0xE44BU, 0x839FU, 0x29CEU, 0xC71CU, 0x6D4DU,
+        0x0CEEU, 0xA6BFU, 0x486DU, 0xE23CU, 0x85E8U, 0x2FB9U, 0xC16BU, 0x6B3AU,
+        0x0EC3U, 0xA492U, 0x4A40U, 0xE011U, 0x87C5U, 0x2D94U, 0xC346U, 0x6917U,
+        0x1168U, 0xBB39U, 0x55EBU, 0xFFBAU, 0x986EU, 0x323FU, 0xDCEDU, 0x76BCU,
+        0x1345U, 0xB914U, 0x57C6U, 0xFD97U, 0x9A43U, 0x3012U, 0xDEC0U, 0x7491U,
+        0x1532U, 0xBF63U, 0x51B1U, 0xFBE0U, 0x9C34U, 0x3665U, 0xD8B7U, 0x72E6U,
+        0x171FU, 0xBD4EU, 0x539CU, 0xF9CDU, 0x9E19U, 0x3448U, 0xDA9AU, 0x70CBU,
+        0x19DCU, 0xB38DU, 0x5D5FU, 0xF70EU, 0x90DAU, 0x3A8BU, 0xD459U, 0x7E08U,
+        0x1BF1U, 0xB1A0U, 0x5F72U, 0xF523U, 0x92F7U, 0x38A6U, 0xD674U, 0x7C25U,
+        0x1D86U, 0xB7D7U, 0x5905U, 0xF354U, 0x9480U, 0x3ED1U, 0xD003U, 0x7A52U,
+        0x1FABU, 0xB5FAU, 0x5B28U, 0xF179U, 0x96ADU, 0x3CFCU, 0xD22EU, 0x787FU,
+        0x22D0U, 0x8881U, 0x6653U, 0xCC02U, 0xABD6U, 0x0187U, 0xEF55U, 0x4504U,
+        0x20FDU, 0x8AACU, 0x647EU, 0xCE2FU, 0xA9FBU, 0x03AAU, 0xED78U, 0x4729U,
+        0x268AU, 0x8CDBU, 0x6209U, 0xC858U, 0xAF8CU, 0x05DDU, 0xEB0FU, 0x415EU,
+        0x24A7U, 0x8EF6U, 0x6024U, 0xCA75U, 0xADA1U, 0x07F0U, 0xE922U, 0x4373U,
+        0x2A64U, 0x8035U, 0x6EE7U, 0xC4B6U, 0xA362U, 0x0933U, 0xE7E1U, 0x4DB0U,
+        0x2849U, 0x8218U, 0x6CCAU, 0xC69BU, 0xA14FU, 0x0B1EU, 0xE5CCU, 0x4F9DU,
+        0x2E3EU, 0x846FU, 0x6ABDU, 0xC0ECU, 0xA738U, 0x0D69U, 0xE3BBU, 0x49EAU,
+        0x2C13U, 0x8642U, 0x6890U, 0xC2C1U, 0xA515U, 0x0F44U, 0xE196U, 0x4BC7U,
+        0x33B8U, 0x99E9U, 0x773BU, 0xDD6AU, 0xBABEU, 0x10EFU, 0xFE3DU, 0x546CU,
+        0x3195U, 0x9BC4U, 0x7516U, 0xDF47U, 0xB893U, 0x12C2U, 0xFC10U, 0x5641U,
+        0x37E2U, 0x9DB3U, 0x7361U, 0xD930U, 0xBEE4U, 0x14B5U, 0xFA67U, 0x5036U,
+        0x35CFU, 0x9F9EU, 0x714CU, 0xDB1DU, 0xBCC9U, 0x1698U, 0xF84AU, 0x521BU,
+        0x3B0CU, 0x915DU, 0x7F8FU, 0xD5DEU, 0xB20AU, 0x185BU, 0xF689U, 0x5CD8U,
+        0x3921U, 0x9370U, 0x7DA2U, 0xD7F3U, 0xB027U, 0x1A76U, 0xF4A4U, 0x5EF5U,
+        0x3F56U, 0x9507U, 0x7BD5U, 0xD184U, 0xB650U, 0x1C01U, 0xF2D3U, 0x5882U,
+        0x3D7BU, 0x972AU, 0x79F8U, 0xD3A9U, 0xB47DU, 0x1E2CU, 0xF0FEU, 0x5AAFU,
+    },
+    {
+        0x0000U, 0x45A0U, 0x8B40U, 0xCEE0U, 0x06A1U, 0x4301U, 0x8DE1U, 0xC841U,
+        0x0D42U, 0x48E2U, 0x8602U, 0xC3A2U, 0x0BE3U, 0x4E43U, 0x80A3U, 0xC503U,
+        0x1A84U, 0x5F24U, 0x91C4U, 0xD464U, 0x1C25U, 0x5985U, 0x9765U, 0xD2C5U,
+        0x17C6U, 0x5266U, 0x9C86U, 0xD926U, 0x1167U, 0x54C7U, 0x9A27U, 0xDF87U,
+        0x3508U, 0x70A8U, 0xBE48U, 0xFBE8U, 0x33A9U, 0x7609U, 0xB8E9U, 0xFD49U,
+        0x384AU, 0x7DEAU, 0xB30AU, 0xF6AAU, 0x3EEBU, 0x7B4BU, 0xB5ABU, 0xF00BU,
+        0x2F8CU, 0x6A2CU, 0xA4CCU, 0xE16CU, 0x292DU, 0x6C8DU, 0xA26DU, 0xE7CDU,
+        0x22CEU, 0x676EU, 0xA98EU, 0xEC2EU, 0x246FU, 0x61CFU, 0xAF2FU, 0xEA8FU,
+        0x6A10U, 0x2FB0U, 0xE150U, 0xA4F0U, 0x6CB1U, 0x2911U, 0xE7F1U, 0xA251U,
+        0x6752U, 0x22F2U, 0xEC12U, 0xA9B2U, 0x61F3U, 0x2453U, 0xEAB3U, 0xAF13U,
+        0x7094U, 0x3534U, 0xFBD4U, 0xBE74U, 0x7635U, 0x3395U, 0xFD75U, 0xB8D5U,
+        0x7DD6U, 0x3876U, 0xF696U, 0xB336U, 0x7B77U, 0x3ED7U, 0xF037U, 0xB597U,
+        0x5F18U, 0x1AB8U, 0xD458U, 0x91F8U, 0x59B9U, 0x1C19U, 0xD2F9U, 0x9759U,
+        0x525AU, 0x17FAU, 0xD91AU, 0x9CBAU, 0x54FBU, 0x115BU, 0xDFBBU, 0x9A1BU,
+        0x459CU, 0x003CU, 0xCEDCU, 0x8B7CU, 0x433DU, 0x069DU, 0xC87DU, 0x8DDDU,
+        0x48DEU, 0x0D7EU, 0xC39EU, 0x863EU, 0x4E7FU, 0x0BDFU, 0xC53FU, 0x809FU,
+        0xD420U, 0x9180U, 0x5F60U, 0x1AC0U, 0xD281U, 0x9721U, 0x59C1U, 0x1C61U,
+        0xD962U, 0x9CC2U, 0x5222U, 0x1782U, 0xDFC3U, 0x9A63U, 0x5483U, 0x1123U,
+        0xCEA4U, 0x8B04U, 0x45E4U, 0x0044U, 0xC805U, 0x8DA5U, 0x4345U, 0x06E5U,
+        0xC3E6U, 0x8646U, 0x48A6U, 0x0D06U, 0xC547U, 0x80E7U, 0x4E07U, 0x0BA7U,
+        0xE128U, 0xA488U, 0x6A68U, 0x2FC8U, 0xE789U, 0xA229U, 0x6CC9U, 0x2969U,
+        0xEC6AU, 0xA9CAU, 0x672AU, 0x228AU, 0xEACBU, 0xAF6BU, 0x618BU, 0x242BU,
+        0xFBACU, 0xBE0CU, 0x70ECU, 0x354CU, 0xFD0DU, 0xB8ADU, 0x764DU, 0x33EDU,
+        0xF6EEU, 0xB34EU, 0x7DAEU, 0x380EU, 0xF04FU, 0xB5EFU, 0x7B0FU, 0x3EAFU,
+        0xBE30U, 0xFB90U, 0x3570U, 0x70D0U, 0xB891U, 0xFD31U, 0x33D1U, 0x7671U,
+        0xB372U, 0xF6D2U, 0x3832U, 0x7D92U, 0xB5D3U, 0xF073U, 0x3E93U, 0x7B33U,
+        0xA4B4U, 0xE114U, 0x2FF4U, 0x6A54U, 0xA215U, 0xE7B5U, 0x2955U, 0x6CF5U,
+        0xA9F6U, 0xEC56U, 0x22B6U, 0x6716U, 0xAF57U, 0xEAF7U, 0x2417U, 0x61B7U,
+        0x8B38U, 0xCE98U, 0x0078U, 0x45D8U, 0x8D99U, 0xC839U, 0x06D9U, 0x4379U,
+        0x867AU, 0xC3DAU, 0x0D3AU, 0x489AU, 0x80DBU, 0xC57BU, 0x0B9BU, 0x4E3BU,
+        0x91BCU, 0xD41CU, 0x1AFCU, 0x5F5CU, 0x971DU, 0xD2BDU, 0x1C5DU, 0x59FDU,
+        0x9CFEU, 0xD95EU, 0x17BEU, 0x521EU, 0x9A5FU, 0xDFFFU, 0x111FU, 0x54BFU,
+    },
+    {
+        0x0000U, 0xB861U, 0x60E3U, 0xD882U, 0xC1C6U, 0x79A7U, 0xA125U, 0x1944U,
+        0x93ADU, 0x2BCCU, 0xF34EU, 0x4B2FU, 0x526BU, 0xEA0AU, 0x3288U, 0x8AE9U,
+        0x377BU, 0x8F1AU, 0x5798U, 0xEFF9U, 0xF6BDU, 0x4EDCU, 0x965EU, 0x2E3FU,
+        0xA4D6U, 0x1CB7U, 0xC435U, 0x7C54U, 0x6510U, 0xDD71U, 0x05F3U, 0xBD92U,
+        0x6EF6U, 0xD697U, 0x0E15U, 0xB674U, 0xAF30U, 0x1751U, 0xCFD3U, 0x77B2U,
+        0xFD5BU, 0x453AU, 0x9DB8U, 0x25D9U, 0x3C9DU, 0x84FCU, 0x5C7EU, 0xE41FU,
+        0x598DU, 0xE1ECU, 0x396EU, 0x810FU, 0x984BU, 0x202AU, 0xF8A8U, 0x40C9U,
+        0xCA20U, 0x7241U, 0xAAC3U, 0x12A2U, 0x0BE6U, 0xB387U, 0x6B05U, 0xD364U,
+        0xDDECU, 0x658DU, 0xBD0FU, 0x056EU, 0x1C2AU, 0xA44BU, 0x7CC9U, 0xC4A8U,
+        0x4E41U, 0xF620U, 0x2EA2U, 0x96C3U, 0x8F87U, 0x37E6U, 0xEF64U, 0x5705U,
+        0xEA97U, 0x52F6U, 0x8A74U, 0x3215U, 0x2B51U, 0x9330U, 0x4BB2U, 0xF3D3U,
+        0x793AU, 0xC15BU, 0x19D9U, 0xA1B8U, 0xB8FCU, 0x009DU, 0xD81FU, 0x607EU,
+        0xB31AU, 0x0B7BU, 0xD3F9U, 0x6B98U, 0x72DCU, 0xCABDU, 0x123FU, 0xAA5EU,
+        0x20B7U, 0x98D6U, 0x4054U, 0xF835U, 0xE171U, 0x5910U, 0x8192U, 0x39F3U,
+        0x8461U, 0x3C00U, 0xE482U, 0x5CE3U, 0x45A7U, 0xFDC6U, 0x2544U, 0x9D25U,
+        0x17CCU, 0xAFADU, 0x772FU, 0xCF4EU, 0xD60AU, 0x6E6BU, 0xB6E9U, 0x0E88U,
+        0xABF9U, 0x1398U, 0xCB1AU, 0x737BU, 0x6A3FU, 0xD25EU, 0x0ADCU, 0xB2BDU,
+        0x3854U, 0x8035U, 0x58B7U, 0xE0D6U, 0xF992U, 0x41F3U, 0x9971U, 0x2110U,
+        0x9C82U, 0x24E3U, 0xFC61U, 0x4400U, 0x5D44U, 0xE525U, 0x3DA7U, 0x85C6U,
+        0x0F2FU, 0xB74EU, 0x6FCCU, 0xD7ADU, 0xCEE9U, 0x7688U, 0xAE0AU, 0x166BU,
+        0xC50FU, 0x7D6EU, 0xA5ECU, 0x1D8DU, 0x04C9U, 0xBCA8U, 0x642AU, 0xDC4BU,
+        0x56A2U, 0xEEC3U, 0x3641U, 0x8E20U, 0x9764U, 0x2F05U, 0xF787U, 0x4FE6U,
+        0xF274U, 0x4A15U, 0x9297U, 0x2AF6U, 0x33B2U, 0x8BD3U, 0x5351U, 0xEB30U,
+        0x61D9U, 0xD9B8U, 0x013AU, 0xB95BU, 0xA01FU, 0x187EU, 0xC0FCU, 0x789DU,
+        0x7615U, 0xCE74U, 0x16F6U, 0xAE97U, 0xB7D3U, 0x0FB2U, 0xD730U, 0x6F51U,
+        0xE5B8U, 0x5DD9U, 0x855BU, 0x3D3AU, 0x247EU, 0x9C1FU, 0x449DU, 0xFCFCU,
+        0x416EU, 0xF90FU, 0x218DU, 0x99ECU, 0x80A8U, 0x38C9U, 0xE04BU, 0x582AU,
+        0xD2C3U, 0x6AA2U, 0xB220U, 0x0A41U, 0x1305U, 0xAB64U, 0x73E6U, 0xCB87U,
+        0x18E3U, 0xA082U, 0x7800U, 0xC061U, 0xD925U, 0x6144U, 0xB9C6U, 0x01A7U,
+        0x8B4EU, 0x332FU, 0xEBADU, 0x53CCU, 0x4A88U, 0xF2E9U, 0x2A6BU, 0x920AU,
+        0x2F98U, 0x97F9U, 0x4F7BU, 0xF71AU, 0xEE5EU, 0x563FU, 0x8EBDU, 0x36DCU,
+        0xBC35U, 0x0454U, 0xDCD6U, 0x64B7U, 0x7DF3U, 0xC592U, 0x1D10U, 0xA571U,
+    },
+    {
+        0x0000U, 0x47D3U, 0x8FA6U, 0xC875U, 0x0F6DU, 0x48BEU, 0x80CBU, 0xC718U,
+        0x1EDAU, 0x5909U, 0x917CU, 0xD6AFU, 0x11B7U, 0x5664U, 0x9E11U, 0xD9C2U,
+        0x3DB4U, 0x7A67U, 0xB212U, 0xF5C1U, 0x32D9U, 0x750AU, 0xBD7FU, 0xFAACU,
+        0x236EU, 0x64BDU, 0xACC8U, 0xEB1BU, 0x2C03U, 0x6BD0U, 0xA3A5U, 0xE476U,
+        0x7B68U, 0x3CBBU, 0xF4CEU, 0xB31DU, 0x7405U, 0x33D6U, 0xFBA3U, 0xBC70U,
+        0x65B2U, 0x2261U, 0xEA14U, 0xADC7U, 0x6ADFU, 0x2D0CU, 0xE579U, 0xA2AAU,
+        0x46DCU, 0x010FU, 0xC97AU, 0x8EA9U, 0x49B1U, 0x0E62U, 0xC617U, 0x81C4U,
+        0x5806U, 0x1FD5U, 0xD7A0U, 0x9073U, 0x576BU, 0x10B8U, 0xD8CDU, 0x9F1EU,
+        0xF6D0U, 0xB103U, 0x7976U, 0x3EA5U, 0xF9BDU, 0xBE6EU, 0x761BU, 0x31C8U,
+        0xE80AU, 0xAFD9U, 0x67ACU, 0x207FU, 0xE767U, 0xA0B4U, 0x68C1U, 0x2F12U,
+        0xCB64U, 0x8CB7U, 0x44C2U, 0x0311U, 0xC409U, 0x83DAU, 0x4BAFU, 0x0C7CU,
+        0xD5BEU, 0x926DU, 0x5A18U, 0x1DCBU, 0xDAD3U, 0x9D00U, 0x5575U, 0x12A6U,
+        0x8DB8U, 0xCA6BU, 0x021EU, 0x45CDU, 0x82D5U, 0xC506U, 0x0D73U, 0x4AA0U,
+        0x9362U, 0xD4B1U, 0x1CC4U, 0x5B17U, 0x9C0FU, 0xDBDCU, 0x13A9U, 0x547AU,
+        0xB00CU, 0xF7DFU, 0x3FAAU, 0x7879U, 0xBF61U, 0xF8B2U, 0x30C7U, 0x7714U,
+        0xAED6U, 0xE905U, 0x2170U, 0x66A3U, 0xA1BBU, 0xE668U, 0x2E1DU, 0x69CEU,
+        0xFD81U, 0xBA52U, 0x7227U, 0x35F4U, 0xF2ECU, 0xB53FU, 0x7D4AU, 0x3A99U,
+        0xE35BU, 0xA488U, 0x6CFDU, 0x2B2EU, 0xEC36U, 0xABE5U, 0x6390U, 0x2443U,
+        0xC035U, 0x87E6U, 0x4F93U, 0x0840U, 0xCF58U, 0x888BU, 0x40FEU, 0x072DU,
+        0xDEEFU, 0x993CU, 0x5149U, 0x169AU, 0xD182U, 0x9651U, 0x5E24U, 0x19F7U,
+        0x86E9U, 0xC13AU, 0x094FU, 0x4E9CU, 0x8984U, 0xCE57U, 0x0622U, 0x41F1U,
+        0x9833U, 0xDFE0U, 0x1795U, 0x5046U, 0x975EU, 0xD08DU, 0x18F8U, 0x5F2BU,
+        0xBB5DU, 0xFC8EU, 0x34FBU, 0x7328U, 0xB430U, 0xF3E3U, 0x3B96U, 0x7C45U,
+        0xA587U, 0xE254U, 0x2A21U, 0x6DF2U, 0xAAEAU, 0xED39U, 0x254CU, 0x629FU,
+        0x0B51U, 0x4C82U, 0x84F7U, 0xC324U, 0x043CU, 0x43EFU, 0x8B9AU, 0xCC49U,
+        0x158BU, 0x5258U, 0x9A2DU, 0xDDFEU, 0x1AE6U, 0x5D35U, 0x9540U, 0xD293U,
+        0x36E5U, 0x7136U, 0xB943U, 0xFE90U, 0x3988U, 0x7E5BU, 0xB62EU, 0xF1FDU,
+        0x283FU, 0x6FECU, 0xA799U, 0xE04AU, 0x2752U, 0x6081U, 0xA8F4U, 0xEF27U,
+        0x7039U, 0x37EAU, 0xFF9FU, 0xB84CU, 0x7F54U, 0x3887U, 0xF0F2U, 0xB721U,
+        0x6EE3U, 0x2930U, 0xE145U, 0xA696U, 0x618EU, 0x265DU, 0xEE28U, 0xA9FBU,
+        0x4D8DU, 0x0A5EU, 0xC22BU, 0x85F8U, 0x42E0U, 0x0533U, 0xCD46U, 0x8A95U,
+        0x5357U, 0x1484U, 0xDCF1U, 0x9B22U, 0x5C3AU, 0x1BE9U, 0xD39CU, 0x944FU,
+    },
+#        endif
+};
+
+CANARD_PRIVATE TransferCRC crcAddByte(const TransferCRC crc, const uint8_t byte);
+CANARD_PRIVATE TransferCRC crcAddByte(const TransferCRC crc, const uint8_t byte)
+{
+    return (uint16_t)((uint16_t)(crc << BITS_PER_BYTE) ^ CRCTable[0][(uint8_t)(crc >> BITS_PER_BYTE) ^ byte]);
+}
+
+CANARD_PRIVATE TransferCRC crcAddBytes(const TransferCRC crc, const size_t size, const uint8_t* const data);
+CANARD_PRIVATE TransferCRC crcAddBytes(const TransferCRC crc, const size_t size, const uint8_t* const data)
+{
+    TransferCRC    out = crc;
+    const uint8_t* p   = data;
+    size_t         n   = size;
+#    if CRC_TABLE_ROWS > 1
+    // Slicing-by-8: the CRC is folded into the first two bytes of each 8-byte block, and the block is then reduced
+    // by looking up every byte in the row that accounts for its distance from the end of the block.
+    while (n >= 8U)
+    {
+        out = (uint16_t)(CRCTable[7][(uint8_t)(p[0] ^ (out >> BITS_PER_BYTE))] ^
+                         CRCTable[6][(uint8_t)(p[1] ^ (out & BYTE_MAX))] ^ CRCTable[5][p[2]] ^ CRCTable[4][p[3]] ^
+                         CRCTable[3][p[4]] ^ CRCTable[2][p[5]] ^ CRCTable[1][p[6]] ^ CRCTable[0][p[7]]);
+        p += 8U;
+        n -= 8U;
+    }
+#    endif
+    while (n > 0U)
+    {
+        out = crcAddByte(out, *p);
+        ++p;
+        --n;
+    }
+    return out;
+}
+
+#    if (CANARD_CONFIG_CRC == CANARD_CRC_CLMUL) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#        include <immintrin.h>
+#        define CRC_CLMUL_TARGET __attribute__((target("pclmul,ssse3")))
+#        define CRC_CLMUL_AVAILABLE \
+            (__builtin_cpu_init(), __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("ssse3"))
+#    elif (CANARD_CONFIG_CRC == CANARD_CRC_CLMUL) && defined(__GNUC__) && defined(__aarch64__) && \
+        defined(__ARM_FEATURE_CRYPTO) && defined(__linux__)
+#        include <arm_neon.h>
+#        include <sys/auxv.h>
+#        define CRC_CLMUL_TARGET
+#        define CRC_CLMUL_AVAILABLE ((getauxval(AT_HWCAP) & HWCAP_PMULL) != 0U)
+#    endif
+
+#    ifdef CRC_CLMUL_TARGET
+
+/// Inputs shorter than this go through the tables; the fold only pays off over several 16-byte blocks.
+#        define CRC_CLMUL_MIN_SIZE 64U
+
+/// x^128 mod P and x^192 mod P: the weights of the low and high halves of the 128-bit remainder when it is
+/// moved past the next 16-byte block.
+#        define CRC_CLMUL_K128 0xAEFCU
+#        define CRC_CLMUL_K192 0x650BU
+
+/// Computed once at startup so that the dispatch costs a single load per call.
+static bool crcClmulAvailable = false;
+
+__attribute__((constructor)) static void crcClmulDetect(void)
+{
+    crcClmulAvailable = CRC_CLMUL_AVAILABLE;
+}
+
+/// The running CRC is added to the first two bytes, and the first 16-byte block is the initial remainder, which is then
+/// carried over each further 16-byte block with carry-less multiplications by x^128 and x^192 modulo P. The products of a 64-bit half by a 16-bit constant
+/// span at most 79 bits, so the remainder never outgrows 128 bits. The final remainder and the tail are reduced
+/// through the tables with a zero initial CRC, which yields the CRC of the whole input.
+/// The data is big-endian in the CRC sense: the first byte carries the highest powers of x.
+CRC_CLMUL_TARGET
+CANARD_PRIVATE TransferCRC crcAddClmul(const TransferCRC crc, const size_t size, const uint8_t* const data);
+CRC_CLMUL_TARGET
+CANARD_PRIVATE TransferCRC crcAddClmul(const TransferCRC crc, const size_t size, const uint8_t* const data)
+{
+    CANARD_ASSERT(size >= CRC_CLMUL_MIN_SIZE);
+    const uint8_t* p = data;
+    size_t         n = size;
+    uint8_t        rem[16];
+#        if defined(__x86_64__) || defined(__i386__)
+    const __m128i reverse = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    const __m128i k       = _mm_set_epi64x((long long) CRC_CLMUL_K192, (long long) CRC_CLMUL_K128);
+    __m128i       acc     = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*) p), reverse);
+    acc                   = _mm_xor_si128(acc, _mm_set_epi16((short) crc, 0, 0, 0, 0, 0, 0, 0));
+    p += 16U;
+    n -= 16U;
+    while (n >= 16U)
+    {
+        const __m128i block = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*) p), reverse);
+        acc = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(acc, k, 0x11), _mm_clmulepi64_si128(acc, k, 0x00)),
+                            block);
+        p += 16U;
+        n -= 16U;
+    }
+    _mm_storeu_si128((__m128i*) rem, _mm_shuffle_epi8(acc, reverse));
+#        else
+    uint8x16_t acc = vld1q_u8(p);
+    acc            = veorq_u8(acc, vcombine_u8(vcreate_u8(((uint64_t)(crc & BYTE_MAX) << 8U) | (uint64_t)(crc >> 8U)),
+                                               vcreate_u8(0U)));
+    p += 16U;
+    n -= 16U;
+    while (n >= 16U)
+    {
+        // Reversing the bytes of each half turns the big-endian halves into native 64-bit polynomials.
+        const uint64x2_t halves = vreinterpretq_u64_u8(vrev64q_u8(acc));
+        const poly128_t  hi     = vmull_p64((poly64_t) vgetq_lane_u64(halves, 0), (poly64_t) CRC_CLMUL_K192);
+        const poly128_t  lo     = vmull_p64((poly64_t) vgetq_lane_u64(halves, 1), (poly64_t) CRC_CLMUL_K128);
+        const uint64x2_t fold   = veorq_u64(vreinterpretq_u64_p128(hi), vreinterpretq_u64_p128(lo));
+        // Back to the big-endian byte order of the input: the high half first, each half byte-reversed.
+        const uint8x16_t folded =
+            vrev64q_u8(vreinterpretq_u8_u64(vcombine_u64(vget_high_u64(fold), vget_low_u64(fold))));
+        acc = veorq_u8(folded, vld1q_u8(p));
+        p += 16U;
+        n -= 16U;
+    }
+    vst1q_u8(rem, acc);
+#        endif
+    return crcAddBytes(crcAddBytes(0U, sizeof(rem), rem), n, p);
+}
+
+#    endif
+
+CANARD_PRIVATE TransferCRC crcAdd(const TransferCRC crc, const size_t size, const void* const data);
+CANARD_PRIVATE TransferCRC crcAdd(const TransferCRC crc, const size_t size, const void* const data)
+{
+    CANARD_ASSERT((data != NULL) || (size == 0U));
+#    ifdef CRC_CLMUL_TARGET
+    if (crcClmulAvailable && (size >= CRC_CLMUL_MIN_SIZE))
+    {
+        return crcAddClmul(crc, size, (const uint8_t*) data);
+    }
+#    endif
+    return crcAddBytes(crc, size, (const uint8_t*) data);
+}
+
+#endif
+
 // --------------------------------------------- TRANSMISSION ---------------------------------------------
 
-/// This is a subclass of CanardFrame. A pointer to this type can be cast to CanardFrame safely.
-/// This is standard-compliant. The paragraph 6.7.2.1.15 says:
-///     A pointer to a structure object, suitably converted, points to its initial member (or if that member is a
-///     bit-field, then to the unit in which it resides), and vice versa. There may be unnamed padding within a
-///     structure object, but not at its beginning.
+/// A queue item is the descriptor of one whole transfer. Its buffer holds the transfer payload followed, for a
+/// multi-frame transfer, by the padding of the last frame and the transfer CRC, which is exactly the byte stream that
+/// is carried by the frames. The frames are generated from it one at a time by canardTxEmit() straight into the buffer
+/// supplied by the application, so a transfer takes one allocation and one copy into the queue however long it is.
+///
+/// The queue is an AVL tree keyed by CAN ID with one node per distinct CAN ID. Each node is the first transfer of a
+/// FIFO of all enqueued transfers sharing that CAN ID, linked through next; the tree fields are meaningful only in the
+/// first item of each FIFO. Transfers of equal CAN ID thus leave in the order they were pushed and the frames of a
+/// transfer stay contiguous. The leftmost node, i.e., the transfer of the next frame to transmit, is cached in the
+/// instance.
 typedef struct CanardInternalTxQueueItem
 {
-    CanardFrame                       frame;
     struct CanardInternalTxQueueItem* next;
 
+    struct CanardInternalTxQueueItem* up;
+    struct CanardInternalTxQueueItem* lr[2];
+    struct CanardInternalTxQueueItem* tail;  // Last transfer of the FIFO.
+
+    CanardMicrosecond deadline_usec;
+    size_t            size;    // Bytes in the buffer: payload, padding, and CRC.
+    size_t            offset;  // Bytes of the buffer already emitted in earlier frames.
+    size_t            mtu;     // Presentation layer MTU at the time the transfer was pushed.
+    uint32_t          can_id;
+    CanardTransferID  transfer_id;
+    bool              toggle;
+    int8_t            bf;  // Height of the right subtree minus that of the left subtree.
+
     // Intentional violation of MISRA: this flex array is the lesser of three evils. The other two are:
     //  - Make the payload pointer point to the remainder of the allocated memory following this structure.
     //    The pointer is bad because it requires us to use pointer arithmetics.
@@ -256,61 +711,258 @@ CANARD_PRIVATE size_t txRoundFramePayloadSizeUp(const size_t x)
 }
 
 CANARD_PRIVATE CanardInternalTxQueueItem* txAllocateQueueItem(CanardInstance* const   ins,
-                                                              const uint32_t          id,
+                                                              const size_t            presentation_layer_mtu,
                                                               const CanardMicrosecond deadline_usec,
-                                                              const size_t            payload_size);
-CANARD_PRIVATE CanardInternalTxQueueItem* txAllocateQueueItem(CanardInstance* const   ins,
                                                               const uint32_t          id,
+                                                              const CanardTransferID  transfer_id,
+                                                              const size_t            size);
+CANARD_PRIVATE CanardInternalTxQueueItem* txAllocateQueueItem(CanardInstance* const   ins,
+                                                              const size_t            presentation_layer_mtu,
                                                               const CanardMicrosecond deadline_usec,
-                                                              const size_t            payload_size)
+                                                              const uint32_t          id,
+                                                              const CanardTransferID  transfer_id,
+                                                              const size_t            size)
 {
     CANARD_ASSERT(ins != NULL);
-    CANARD_ASSERT(payload_size > 0U);
+    CANARD_ASSERT((presentation_layer_mtu > 0U) && (presentation_layer_mtu < CANARD_MTU_CAN_FD));
     CanardInternalTxQueueItem* const out =
-        (CanardInternalTxQueueItem*) ins->memory_allocate(ins, sizeof(CanardInternalTxQueueItem) + payload_size);
+        (CanardInternalTxQueueItem*) ins->memory_allocate(ins, sizeof(CanardInternalTxQueueItem) + size);
     if (out != NULL)
     {
-        out->next                  = NULL;
-        out->frame.timestamp_usec  = deadline_usec;
-        out->frame.payload_size    = payload_size;
-        out->frame.payload         = out->payload_buffer;
-        out->frame.extended_can_id = id;
+        out->next          = NULL;
+        out->deadline_usec = deadline_usec;
+        out->size          = size;
+        out->offset        = 0U;
+        out->can_id        = id;
+        out->mtu           = presentation_layer_mtu;
+        out->transfer_id   = (CanardTransferID)(transfer_id & CANARD_TRANSFER_ID_MAX);
+        out->toggle        = INITIAL_TOGGLE_STATE;
     }
     return out;
 }
 
-/// Returns the element after which new elements with the specified CAN ID should be inserted.
-/// Returns NULL if the element shall be inserted in the beginning of the list (i.e., no prior elements).
-CANARD_PRIVATE CanardInternalTxQueueItem* txFindQueueSupremum(const CanardInstance* const ins, const uint32_t can_id);
-CANARD_PRIVATE CanardInternalTxQueueItem* txFindQueueSupremum(const CanardInstance* const ins, const uint32_t can_id)
+/// Rotates the subtree rooted at x to the right if r is true, to the left otherwise.
+CANARD_PRIVATE void txTreeRotate(CanardInternalTxQueueItem* const x, const bool r);
+CANARD_PRIVATE void txTreeRotate(CanardInternalTxQueueItem* const x, const bool r)
 {
-    CANARD_ASSERT(ins != NULL);
-    CANARD_ASSERT(can_id <= CAN_EXT_ID_MASK);
-    CanardInternalTxQueueItem* out = ins->_tx_queue;
-    if ((NULL == out) || (out->frame.extended_can_id > can_id))
+    CANARD_ASSERT((x != NULL) && (x->lr[!r] != NULL));
+    CanardInternalTxQueueItem* const z = x->lr[!r];
+    if (x->up != NULL)
     {
-        out = NULL;
+        x->up->lr[x->up->lr[1] == x] = z;
     }
-    else
+    z->up     = x->up;
+    x->up     = z;
+    x->lr[!r] = z->lr[r];
+    if (x->lr[!r] != NULL)
     {
-        // TODO The linear search should be replaced with O(log n) at least. Please help us here.
-        while ((out != NULL) && (out->next != NULL) && (out->next->frame.extended_can_id <= can_id))
+        x->lr[!r]->up = x;
+    }
+    z->lr[r] = x;
+}
+
+/// Adjusts the balance factor of x after one of its subtrees grew (increment on the right side, decrement on the left)
+/// or shrank (the opposite) by one level, rotating if necessary. Returns the node that took the place of x.
+CANARD_PRIVATE CanardInternalTxQueueItem* txTreeAdjustBalance(CanardInternalTxQueueItem* const x, const bool increment);
+CANARD_PRIVATE CanardInternalTxQueueItem* txTreeAdjustBalance(CanardInternalTxQueueItem* const x, const bool increment)
+{
+    CANARD_ASSERT(x != NULL);
+    CanardInternalTxQueueItem* out    = x;
+    const int8_t               new_bf = (int8_t) (x->bf + (increment ? +1 : -1));
+    if ((new_bf < -1) || (new_bf > 1))
+    {
+        const bool                       r    = new_bf < 0;  // Left-heavy, a right rotation is needed.
+        const int8_t                     sign = r ? +1 : -1;
+        CanardInternalTxQueueItem* const z    = x->lr[!r];
+        CANARD_ASSERT(z != NULL);
+        if ((z->bf * sign) <= 0)  // The child is heavy on the same side or balanced, a single rotation suffices.
+        {
+            out = z;
+            txTreeRotate(x, r);
+            if (0 == z->bf)
+            {
+                x->bf = (int8_t) (-sign);
+                z->bf = (int8_t) (+sign);
+            }
+            else
+            {
+                x->bf = 0;
+                z->bf = 0;
+            }
+        }
+        else  // The child is heavy on the opposite side and has to be rotated first.
         {
-            out = out->next;
+            CanardInternalTxQueueItem* const y = z->lr[r];
+            CANARD_ASSERT(y != NULL);
+            out = y;
+            txTreeRotate(z, !r);
+            txTreeRotate(x, r);
+            if ((y->bf * sign) < 0)  // The taller subtree of y went to z, the shorter one to x.
+            {
+                x->bf = sign;
+                z->bf = 0;
+            }
+            else if ((y->bf * sign) > 0)  // The taller subtree of y went to x, the shorter one to z.
+            {
+                x->bf = 0;
+                z->bf = (int8_t) (-sign);
+            }
+            else
+            {
+                x->bf = 0;
+                z->bf = 0;
+            }
+            y->bf = 0;
         }
     }
-    CANARD_ASSERT((out == NULL) || (out->frame.extended_can_id <= can_id));
+    else
+    {
+        x->bf = new_bf;
+    }
     return out;
 }
 
+/// Inserts the transfer behind the transfers already enqueued with the same CAN ID.
+/// The time complexity is O(log n) of the number of distinct CAN IDs in the queue.
+CANARD_PRIVATE void txEnqueue(CanardInstance* const ins, CanardInternalTxQueueItem* const item);
+CANARD_PRIVATE void txEnqueue(CanardInstance* const ins, CanardInternalTxQueueItem* const item)
+{
+    CANARD_ASSERT((ins != NULL) && (item != NULL) && (NULL == item->next));
+    const uint32_t              can_id   = item->can_id;
+    CanardInternalTxQueueItem*  parent   = NULL;
+    CanardInternalTxQueueItem** link     = &ins->_tx_root;
+    bool                        leftmost = true;
+    while (*link != NULL)
+    {
+        parent = *link;
+        if (parent->can_id == can_id)  // Join the FIFO of this CAN ID.
+        {
+            parent->tail->next = item;
+            parent->tail       = item;
+            return;
+        }
+        const bool r = can_id > parent->can_id;
+        leftmost     = leftmost && !r;
+        link         = &parent->lr[r];
+    }
+
+    item->up    = parent;
+    item->lr[0] = NULL;
+    item->lr[1] = NULL;
+    item->bf    = 0;
+    item->tail  = item;
+    *link       = item;
+    if (leftmost)
+    {
+        ins->_tx_queue = item;
+    }
+
+    // Retrace towards the root until a subtree absorbs the growth.
+    CanardInternalTxQueueItem* c = item;
+    CanardInternalTxQueueItem* p = item->up;
+    while (p != NULL)
+    {
+        c = txTreeAdjustBalance(p, p->lr[1] == c);
+        p = c->up;
+        if (0 == c->bf)
+        {
+            break;
+        }
+    }
+    if (NULL == p)
+    {
+        ins->_tx_root = c;
+    }
+}
+
+/// Removes the leftmost node, which has no left child, from the tree and caches its in-order successor.
+CANARD_PRIVATE void txRemoveLeftmost(CanardInstance* const ins);
+CANARD_PRIVATE void txRemoveLeftmost(CanardInstance* const ins)
+{
+    CanardInternalTxQueueItem* const node = ins->_tx_queue;
+    CANARD_ASSERT((node != NULL) && (NULL == node->lr[0]));
+
+    CanardInternalTxQueueItem* const child = node->lr[1];
+    CanardInternalTxQueueItem*       p     = node->up;
+
+    // The successor is the leftmost node of the right subtree if there is one, otherwise the parent.
+    CanardInternalTxQueueItem* successor = p;
+    if (child != NULL)
+    {
+        successor = child;
+        while (successor->lr[0] != NULL)
+        {
+            successor = successor->lr[0];
+        }
+        child->up = p;
+    }
+    ins->_tx_queue = successor;
+
+    if (NULL == p)
+    {
+        ins->_tx_root = child;
+        return;
+    }
+
+    // The node is the left child of its parent, being the leftmost one. Retrace until a subtree absorbs the shrinkage.
+    CANARD_ASSERT(p->lr[0] == node);
+    p->lr[0]                       = child;
+    bool                       r   = false;
+    CanardInternalTxQueueItem* c   = NULL;
+    for (;;)
+    {
+        c = txTreeAdjustBalance(p, !r);
+        p = c->up;
+        if ((c->bf != 0) || (NULL == p))
+        {
+            break;
+        }
+        r = p->lr[1] == c;
+    }
+    if (NULL == p)
+    {
+        ins->_tx_root = c;
+    }
+}
+
+/// Puts the next frame of a FIFO in the place of its first frame in the tree, which is constant time.
+CANARD_PRIVATE void txReplaceLeftmost(CanardInstance* const ins);
+CANARD_PRIVATE void txReplaceLeftmost(CanardInstance* const ins)
+{
+    CanardInternalTxQueueItem* const old = ins->_tx_queue;
+    CanardInternalTxQueueItem* const next = old->next;
+    CANARD_ASSERT((next != NULL) && (NULL == old->lr[0]));
+
+    next->up    = old->up;
+    next->lr[0] = NULL;
+    next->lr[1] = old->lr[1];
+    next->bf    = old->bf;
+    next->tail  = old->tail;
+    if (next->up != NULL)
+    {
+        next->up->lr[0] = next;
+    }
+    else
+    {
+        ins->_tx_root = next;
+    }
+    if (next->lr[1] != NULL)
+    {
+        next->lr[1]->up = next;
+    }
+    ins->_tx_queue = next;
+}
+
 /// Returns the number of frames enqueued or error (i.e., =1 or <0).
 CANARD_PRIVATE int32_t txPushSingleFrame(CanardInstance* const   ins,
+                                         const size_t            presentation_layer_mtu,
                                          const CanardMicrosecond deadline_usec,
                                          const uint32_t          can_id,
                                          const CanardTransferID  transfer_id,
                                          const size_t            payload_size,
                                          const void* const       payload);
 CANARD_PRIVATE int32_t txPushSingleFrame(CanardInstance* const   ins,
+                                         const size_t            presentation_layer_mtu,
                                          const CanardMicrosecond deadline_usec,
                                          const uint32_t          can_id,
                                          const CanardTransferID  transfer_id,
@@ -319,14 +971,15 @@ CANARD_PRIVATE int32_t txPushSingleFrame(CanardInstance* const   ins,
 {
     CANARD_ASSERT(ins != NULL);
     CANARD_ASSERT((payload != NULL) || (payload_size == 0));
+    CANARD_ASSERT(payload_size <= presentation_layer_mtu);
 
-    const size_t frame_payload_size = txRoundFramePayloadSizeUp(payload_size + 1U);
-    CANARD_ASSERT(frame_payload_size > payload_size);
-    const size_t padding_size = frame_payload_size - payload_size - 1U;
-    CANARD_ASSERT((padding_size + payload_size + 1U) == frame_payload_size);
-    int32_t out = 0;
+    const size_t frame_payload_size = txRoundFramePayloadSizeUp(payload_size + 1U) - 1U;
+    CANARD_ASSERT(frame_payload_size >= payload_size);
+    const size_t padding_size = frame_payload_size - payload_size;
+    int32_t      out          = 0;
 
-    CanardInternalTxQueueItem* const tqi = txAllocateQueueItem(ins, can_id, deadline_usec, frame_payload_size);
+    CanardInternalTxQueueItem* const tqi =
+        txAllocateQueueItem(ins, presentation_layer_mtu, deadline_usec, can_id, transfer_id, frame_payload_size);
     if (tqi != NULL)
     {
         if (payload_size > 0U)  // The check is needed to avoid calling memcpy() with a NULL pointer, it's an UB.
@@ -341,18 +994,7 @@ CANARD_PRIVATE int32_t txPushSingleFrame(CanardInstance* const   ins,
         // We ignore it because the safe functions are poorly supported; reliance on them may limit the portability.
         (void) memset(&tqi->payload_buffer[payload_size], PADDING_BYTE_VALUE, padding_size);  // NOLINT
 
-        tqi->payload_buffer[frame_payload_size - 1U] = txMakeTailByte(true, true, true, transfer_id);
-        CanardInternalTxQueueItem* const sup         = txFindQueueSupremum(ins, can_id);
-        if (sup != NULL)
-        {
-            tqi->next = sup->next;
-            sup->next = tqi;
-        }
-        else
-        {
-            tqi->next      = ins->_tx_queue;
-            ins->_tx_queue = tqi;
-        }
+        txEnqueue(ins, tqi);
         out = 1;  // One frame enqueued.
     }
     else
@@ -384,118 +1026,39 @@ CANARD_PRIVATE int32_t txPushMultiFrame(CanardInstance* const   ins,
     CANARD_ASSERT(payload_size > presentation_layer_mtu);  // Otherwise, a single-frame transfer should be used.
     CANARD_ASSERT(payload != NULL);
 
-    int32_t out = 0;  // The number of frames enqueued or negated error.
-
-    CanardInternalTxQueueItem* head = NULL;  // Head and tail of the linked list of frames of this transfer.
-    CanardInternalTxQueueItem* tail = NULL;
-
-    const size_t   payload_size_with_crc = payload_size + CRC_SIZE_BYTES;
-    size_t         offset                = 0U;
-    TransferCRC    crc                   = crcAdd(CRC_INITIAL, payload_size, payload);
-    bool           start_of_transfer     = true;
-    bool           toggle                = INITIAL_TOGGLE_STATE;
-    const uint8_t* payload_ptr           = (const uint8_t*) payload;
-
-    while (offset < payload_size_with_crc)
+    // Every frame but the last one is full. The last one is padded up to the nearest valid DLC; the padding goes
+    // between the payload and the CRC, and it is covered by the CRC. If the CRC is split between the last two frames,
+    // the last frame carries one byte of it plus the tail byte, which is always a valid length, so no padding is needed.
+    const size_t payload_size_with_crc = payload_size + CRC_SIZE_BYTES;
+    const size_t last_frame_size       = payload_size_with_crc % presentation_layer_mtu;
+    const size_t padding_size =
+        (last_frame_size > 0U) ? (txRoundFramePayloadSizeUp(last_frame_size + 1U) - 1U - last_frame_size) : 0U;
+    const size_t size = payload_size_with_crc + padding_size;
+
+    int32_t                          out = 0;  // The number of frames enqueued or negated error.
+    CanardInternalTxQueueItem* const tqi =
+        txAllocateQueueItem(ins, presentation_layer_mtu, deadline_usec, can_id, transfer_id, size);
+    if (tqi != NULL)
     {
-        ++out;
-        const size_t frame_payload_size_with_tail =
-            ((payload_size_with_crc - offset) < presentation_layer_mtu)
-                ? txRoundFramePayloadSizeUp((payload_size_with_crc - offset) + 1U)  // Padding in the last frame only.
-                : (presentation_layer_mtu + 1U);
-        CanardInternalTxQueueItem* const tqi =
-            txAllocateQueueItem(ins, can_id, deadline_usec, frame_payload_size_with_tail);
-        if (NULL == head)
-        {
-            head = tqi;
-        }
-        else
-        {
-            tail->next = tqi;
-        }
-        tail = tqi;
-        if (NULL == tail)
-        {
-            break;
-        }
-
-        // Copy the payload into the frame.
-        const size_t frame_payload_size = frame_payload_size_with_tail - 1U;
-        size_t       frame_offset       = 0U;
-        if (offset < payload_size)
-        {
-            size_t move_size = payload_size - offset;
-            if (move_size > frame_payload_size)
-            {
-                move_size = frame_payload_size;
-            }
-            // Clang-Tidy raises an error recommending the use of memcpy_s() instead.
-            // We ignore it because the safe functions are poorly supported; reliance on them may limit the portability.
-            (void) memcpy(&tail->payload_buffer[0], payload_ptr, move_size);  // NOLINT
-            frame_offset = frame_offset + move_size;
-            offset += move_size;
-            payload_ptr += move_size;
-        }
-
-        // Handle the last frame of the transfer: it is special because it also contains padding and CRC.
-        if (offset >= payload_size)
+        // Clang-Tidy raises an error recommending the use of memcpy_s() and memset_s() instead.
+        // We ignore it because the safe functions are poorly supported; reliance on them may limit the portability.
+        (void) memcpy(&tqi->payload_buffer[0], payload, payload_size);                        // NOLINT
+        (void) memset(&tqi->payload_buffer[payload_size], PADDING_BYTE_VALUE, padding_size);  // NOLINT
+        // The CRC is computed over the source rather than over the fresh copy, which is slower to read back.
+        TransferCRC crc = crcAdd(CRC_INITIAL, payload_size, payload);
+        for (size_t i = 0U; i < padding_size; i++)
         {
-            // Insert padding -- only in the last frame. Don't forget to include padding into the CRC.
-            while ((frame_offset + CRC_SIZE_BYTES) < frame_payload_size)
-            {
-                tail->payload_buffer[frame_offset] = PADDING_BYTE_VALUE;
-                ++frame_offset;
-                crc = crcAddByte(crc, PADDING_BYTE_VALUE);
-            }
-
-            // Insert the CRC.
-            if ((frame_offset < frame_payload_size) && (offset == payload_size))
-            {
-                tail->payload_buffer[frame_offset] = (uint8_t)(crc >> BITS_PER_BYTE);
-                ++frame_offset;
-                ++offset;
-            }
-            if ((frame_offset < frame_payload_size) && (offset > payload_size))
-            {
-                tail->payload_buffer[frame_offset] = (uint8_t)(crc & BYTE_MAX);
-                ++frame_offset;
-                ++offset;
-            }
+            crc = crcAddByte(crc, PADDING_BYTE_VALUE);
         }
+        tqi->payload_buffer[size - 2U] = (uint8_t)(crc >> BITS_PER_BYTE);
+        tqi->payload_buffer[size - 1U] = (uint8_t)(crc & BYTE_MAX);
 
-        // Finalize the frame.
-        CANARD_ASSERT((frame_offset + 1U) == tail->frame.payload_size);
-        tail->payload_buffer[frame_offset] =
-            txMakeTailByte(start_of_transfer, offset >= payload_size_with_crc, toggle, transfer_id);
-        start_of_transfer = false;
-        toggle            = !toggle;
+        txEnqueue(ins, tqi);
+        out = (int32_t)((size + presentation_layer_mtu - 1U) / presentation_layer_mtu);
     }
-
-    if (tail != NULL)
-    {
-        CANARD_ASSERT(head->next != NULL);  // This is not a single-frame transfer so at least two frames shall exist.
-        CANARD_ASSERT(tail->next == NULL);  // The list shall be properly terminated.
-        CanardInternalTxQueueItem* const sup = txFindQueueSupremum(ins, can_id);
-        if (NULL == sup)  // Once the insertion point is located, we insert the entire frame sequence in constant time.
-        {
-            tail->next     = ins->_tx_queue;
-            ins->_tx_queue = head;
-        }
-        else
-        {
-            tail->next = sup->next;
-            sup->next  = head;
-        }
-    }
-    else  // Failed to allocate at least one frame in the queue! Remove all frames and abort.
+    else
     {
         out = -CANARD_ERROR_OUT_OF_MEMORY;
-        while (head != NULL)
-        {
-            CanardInternalTxQueueItem* const next = head->next;
-            ins->memory_free(ins, head);
-            head = next;
-        }
     }
 
     CANARD_ASSERT((out < 0) || (out >= 2));
@@ -732,46 +1295,61 @@ CANARD_PRIVATE int8_t rxSessionAcceptFrame(CanardInstance* const          ins,
     }
 
     const bool single_frame = frame->start_of_transfer && frame->end_of_transfer;
-    if (!single_frame)
-    {
-        // Update the CRC. Observe that the implicit truncation rule may apply here: the payload may be
-        // truncated, but its CRC is validated always anyway.
-        rxs->calculated_crc = crcAdd(rxs->calculated_crc, frame->payload_size, frame->payload);
-    }
-
-    int8_t out = rxSessionWritePayload(ins, rxs, extent, frame->payload_size, frame->payload);
-    if (out < 0)
+    int8_t out = 0;
+    if (single_frame && ins->rx_single_frame_zero_copy)
     {
-        CANARD_ASSERT(-CANARD_ERROR_OUT_OF_MEMORY == out);
-        rxSessionRestart(ins, rxs);  // Out-of-memory.
+        // Hand out a view into the frame; there is no CRC to check and nothing to reassemble.
+        // The session may still hold the buffer of a multi-frame transfer that was interrupted by this one,
+        // so it is released first.
+        rxSessionRestart(ins, rxs);
+        out = 1;
+        rxInitTransferFromFrame(frame, out_transfer);
+        out_transfer->payload_size = (extent < frame->payload_size) ? extent : frame->payload_size;
+        out_transfer->payload      = frame->payload;
     }
-    else if (frame->end_of_transfer)
+    else
     {
-        CANARD_ASSERT(0 == out);
-        if (single_frame || (CRC_RESIDUE == rxs->calculated_crc))
+        if (!single_frame)
         {
-            out = 1;  // One transfer received, notify the application.
-            rxInitTransferFromFrame(frame, out_transfer);
-            out_transfer->timestamp_usec = rxs->transfer_timestamp_usec;
-            out_transfer->payload_size   = rxs->payload_size;
-            out_transfer->payload        = rxs->payload;
-
-            // Cut off the CRC from the payload if it's there -- we don't want to expose it to the user.
-            CANARD_ASSERT(rxs->total_payload_size >= rxs->payload_size);
-            const size_t truncated_amount = rxs->total_payload_size - rxs->payload_size;
-            if ((!single_frame) && (CRC_SIZE_BYTES > truncated_amount))  // Single-frame transfers don't have CRC.
+            // Update the CRC. Observe that the implicit truncation rule may apply here: the payload may be
+            // truncated, but its CRC is validated always anyway.
+            rxs->calculated_crc = crcAdd(rxs->calculated_crc, frame->payload_size, frame->payload);
+        }
+
+        out = rxSessionWritePayload(ins, rxs, extent, frame->payload_size, frame->payload);
+        if (out < 0)
+        {
+            CANARD_ASSERT(-CANARD_ERROR_OUT_OF_MEMORY == out);
+            rxSessionRestart(ins, rxs);  // Out-of-memory.
+        }
+        else if (frame->end_of_transfer)
+        {
+            CANARD_ASSERT(0 == out);
+            if (single_frame || (CRC_RESIDUE == rxs->calculated_crc))
             {
-                CANARD_ASSERT(out_transfer->payload_size >= (CRC_SIZE_BYTES - truncated_amount));
-                out_transfer->payload_size -= CRC_SIZE_BYTES - truncated_amount;
-            }
+                out = 1;  // One transfer received, notify the application.
+                rxInitTransferFromFrame(frame, out_transfer);
+                out_transfer->timestamp_usec = rxs->transfer_timestamp_usec;
+                out_transfer->payload_size   = rxs->payload_size;
+                out_transfer->payload        = rxs->payload;
+
+                // Cut off the CRC from the payload if it's there -- we don't want to expose it to the user.
+                CANARD_ASSERT(rxs->total_payload_size >= rxs->payload_size);
+                const size_t truncated_amount = rxs->total_payload_size - rxs->payload_size;
+                if ((!single_frame) && (CRC_SIZE_BYTES > truncated_amount))  // Single-frame transfers don't have CRC.
+                {
+                    CANARD_ASSERT(out_transfer->payload_size >= (CRC_SIZE_BYTES - truncated_amount));
+                    out_transfer->payload_size -= CRC_SIZE_BYTES - truncated_amount;
+                }
 
-            rxs->payload = NULL;  // Ownership passed over to the application, nullify to prevent freeing.
+                rxs->payload = NULL;  // Ownership passed over to the application, nullify to prevent freeing.
+            }
+            rxSessionRestart(ins, rxs);  // Successful completion.
+        }
+        else
+        {
+            rxs->toggle = !rxs->toggle;
         }
-        rxSessionRestart(ins, rxs);  // Successful completion.
-    }
-    else
-    {
-        rxs->toggle = !rxs->toggle;
     }
     return out;
 }
@@ -904,29 +1482,93 @@ CANARD_PRIVATE int8_t rxAcceptFrame(CanardInstance* const       ins,
     {
         CANARD_ASSERT(frame->source_node_id == CANARD_NODE_ID_UNSET);
         // Anonymous transfers are stateless. No need to update the state machine, just blindly accept it.
-        // We have to copy the data into an allocated storage because the API expects it: the lifetime shall be
-        // independent of the input data and the memory shall be free-able.
         const size_t payload_size =
             (subscription->_extent < frame->payload_size) ? subscription->_extent : frame->payload_size;
-        void* const payload = ins->memory_allocate(ins, payload_size);
-        if (payload != NULL)
+        if (ins->rx_single_frame_zero_copy)
         {
+            // Anonymous transfers are always single-frame, so the payload can be handed out in place.
             rxInitTransferFromFrame(frame, out_transfer);
             out_transfer->payload_size = payload_size;
-            out_transfer->payload      = payload;
-            // Clang-Tidy raises an error recommending the use of memcpy_s() instead.
-            // We ignore it because the safe functions are poorly supported; reliance on them may limit the portability.
-            (void) memcpy(payload, frame->payload, payload_size);  // NOLINT
-            out = 1;
+            out_transfer->payload      = frame->payload;
+            out                        = 1;
         }
         else
         {
-            out = -CANARD_ERROR_OUT_OF_MEMORY;
+            // We have to copy the data into an allocated storage because the API expects it: the lifetime shall be
+            // independent of the input data and the memory shall be free-able.
+            void* const payload = ins->memory_allocate(ins, payload_size);
+            if (payload != NULL)
+            {
+                rxInitTransferFromFrame(frame, out_transfer);
+                out_transfer->payload_size = payload_size;
+                out_transfer->payload      = payload;
+                // Clang-Tidy raises an error recommending the use of memcpy_s() instead.
+                // We ignore it because the safe functions are poorly supported; reliance on them may limit the
+                // portability.
+                (void) memcpy(payload, frame->payload, payload_size);  // NOLINT
+                out = 1;
+            }
+            else
+            {
+                out = -CANARD_ERROR_OUT_OF_MEMORY;
+            }
         }
     }
     return out;
 }
 
+/// Returns the index of the first indexed message subscription whose port-ID is not less than the specified one.
+CANARD_PRIVATE size_t rxMessageLowerBound(const CanardInstance* const ins, const CanardPortID port_id);
+CANARD_PRIVATE size_t rxMessageLowerBound(const CanardInstance* const ins, const CanardPortID port_id)
+{
+    CANARD_ASSERT(ins != NULL);
+    size_t lo = 0U;
+    size_t hi = ins->_rx_message_count;
+    while (lo < hi)
+    {
+        const size_t mid = lo + ((hi - lo) / 2U);
+        if (ins->_rx_messages[mid]->_port_id < port_id)
+        {
+            lo = mid + 1U;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/// Messages are found by a binary search over the sorted index, services by a direct look-up.
+/// Service-IDs above the maximum are never subscribed, so they yield NULL.
+CANARD_PRIVATE CanardRxSubscription* rxFindSubscription(const CanardInstance* const ins,
+                                                        const CanardTransferKind    transfer_kind,
+                                                        const CanardPortID          port_id);
+CANARD_PRIVATE CanardRxSubscription* rxFindSubscription(const CanardInstance* const ins,
+                                                        const CanardTransferKind    transfer_kind,
+                                                        const CanardPortID          port_id)
+{
+    CANARD_ASSERT(ins != NULL);
+    CanardRxSubscription* out = NULL;
+    if (CanardTransferKindMessage == transfer_kind)
+    {
+        const size_t i = rxMessageLowerBound(ins, port_id);
+        if ((i < ins->_rx_message_count) && (ins->_rx_messages[i]->_port_id == port_id))
+        {
+            out = ins->_rx_messages[i];
+        }
+    }
+    else if (port_id <= CANARD_SERVICE_ID_MAX)
+    {
+        out = ins->_rx_services[(size_t) transfer_kind - 1U][port_id];
+    }
+    else
+    {
+        out = NULL;
+    }
+    return out;
+}
+
 // --------------------------------------------- PUBLIC API ---------------------------------------------
 
 const uint8_t CanardCANDLCToLength[16] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64};
@@ -946,13 +1588,18 @@ CanardInstance canardInit(const CanardMemoryAllocate memory_allocate, const Cana
     CANARD_ASSERT(memory_allocate != NULL);
     CANARD_ASSERT(memory_free != NULL);
     const CanardInstance out = {
-        .user_reference    = NULL,
-        .mtu_bytes         = CANARD_MTU_CAN_FD,
-        .node_id           = CANARD_NODE_ID_UNSET,
-        .memory_allocate   = memory_allocate,
-        .memory_free       = memory_free,
-        ._rx_subscriptions = {NULL, NULL, NULL},
-        ._tx_queue         = NULL,
+        .user_reference            = NULL,
+        .mtu_bytes                 = CANARD_MTU_CAN_FD,
+        .node_id                   = CANARD_NODE_ID_UNSET,
+        .rx_single_frame_zero_copy = false,
+        .memory_allocate           = memory_allocate,
+        .memory_free               = memory_free,
+        ._rx_subscriptions         = {NULL, NULL, NULL},
+        ._rx_services              = {{NULL}},
+        ._rx_messages              = {NULL},
+        ._rx_message_count         = 0U,
+        ._tx_queue                 = NULL,
+        ._tx_root                  = NULL,
     };
     return out;
 }
@@ -969,6 +1616,7 @@ int32_t canardTxPush(CanardInstance* const ins, const CanardTransfer* const tran
             if (transfer->payload_size <= pl_mtu)
             {
                 out = txPushSingleFrame(ins,
+                                        pl_mtu,
                                         transfer->timestamp_usec,
                                         (uint32_t) maybe_can_id,
                                         transfer->transfer_id,
@@ -994,30 +1642,55 @@ int32_t canardTxPush(CanardInstance* const ins, const CanardTransfer* const tran
     return out;
 }
 
-const CanardFrame* canardTxPeek(const CanardInstance* const ins)
+int8_t canardTxEmit(CanardInstance* const ins, CanardFrame* const out_frame, void* const payload_buffer)
 {
-    const CanardFrame* out = NULL;
-    if ((ins != NULL) && (ins->_tx_queue != NULL))
+    int8_t out = -CANARD_ERROR_INVALID_ARGUMENT;
+    if ((ins != NULL) && (out_frame != NULL) && (payload_buffer != NULL))
     {
-        // Return pointer to the TX queue item typed as CanardFrame. Later, the application will be able to free
-        // the memory allocated for the TX queue item using this pointer typed as CanardFrame. Although it may look
-        // sketchy, this is actually safe and standard-compliant. The paragraph 6.7.2.1.15 of the C standard says:
-        //     A pointer to a structure object, suitably converted, points to its initial member (or if that member is a
-        //     bit-field, then to the unit in which it resides), and vice versa. There may be unnamed padding within a
-        //     structure object, but not at its beginning.
-        out = &ins->_tx_queue->frame;
-        CANARD_ASSERT(((void*) out) == ((void*) ins->_tx_queue));
-    }
-    return out;
-}
+        CanardInternalTxQueueItem* const tqi = ins->_tx_queue;
+        if (tqi != NULL)
+        {
+            CANARD_ASSERT((tqi->offset < tqi->size) || (0U == tqi->size));  // Empty transfers still take a frame.
+            const size_t remaining = tqi->size - tqi->offset;
+            const bool   start     = 0U == tqi->offset;
+            const bool   end       = remaining <= tqi->mtu;
+            const size_t size      = end ? remaining : tqi->mtu;
+            uint8_t*     dst       = (uint8_t*) payload_buffer;
 
-void canardTxPop(CanardInstance* const ins)
-{
-    if ((ins != NULL) && (ins->_tx_queue != NULL))
-    {
-        // The memory is NOT deallocated. The application is responsible for that.
-        ins->_tx_queue = ins->_tx_queue->next;
+            // Clang-Tidy raises an error recommending the use of memcpy_s() instead.
+            // We ignore it because the safe functions are poorly supported; reliance on them may limit the portability.
+            (void) memcpy(dst, &tqi->payload_buffer[tqi->offset], size);  // NOLINT
+            dst[size] = txMakeTailByte(start, end, tqi->toggle, tqi->transfer_id);
+
+            out_frame->timestamp_usec  = tqi->deadline_usec;
+            out_frame->extended_can_id = tqi->can_id;
+            out_frame->payload_size    = size + 1U;
+            out_frame->payload         = payload_buffer;
+            CANARD_ASSERT(txRoundFramePayloadSizeUp(out_frame->payload_size) == out_frame->payload_size);
+
+            tqi->offset += size;
+            tqi->toggle = !tqi->toggle;
+            if (end)
+            {
+                // The memory of the transfer is released as soon as its last frame has been generated.
+                if (tqi->next != NULL)
+                {
+                    txReplaceLeftmost(ins);
+                }
+                else
+                {
+                    txRemoveLeftmost(ins);
+                }
+                ins->memory_free(ins, tqi);
+            }
+            out = 1;
+        }
+        else
+        {
+            out = 0;
+        }
     }
+    return out;
 }
 
 int8_t canardRxAccept(CanardInstance* const    ins,
@@ -1034,16 +1707,11 @@ int8_t canardRxAccept(CanardInstance* const    ins,
         {
             if ((CANARD_NODE_ID_UNSET == model.destination_node_id) || (ins->node_id == model.destination_node_id))
             {
-                // Find subscription. This is the reason the function has a linear time complexity from the number of
+                // Find subscription. This is constant-time for services and logarithmic from the number of message
                 // subscriptions. Note also that this one of the two variable-complexity operations in the RX pipeline;
                 // the other one is memcpy(). Excepting these two cases, the entire RX pipeline logic contains neither
                 // loops nor recursion.
-                CanardRxSubscription* sub = ins->_rx_subscriptions[(size_t) model.transfer_kind];
-                while ((sub != NULL) && (sub->_port_id != model.port_id))
-                {
-                    sub = sub->_next;
-                }
-
+                CanardRxSubscription* const sub = rxFindSubscription(ins, model.transfer_kind, model.port_id);
                 if (sub != NULL)
                 {
                     CANARD_ASSERT(sub->_port_id == model.port_id);
@@ -1077,12 +1745,22 @@ int8_t canardRxSubscribe(CanardInstance* const       ins,
 {
     int8_t       out = -CANARD_ERROR_INVALID_ARGUMENT;
     const size_t tk  = (size_t) transfer_kind;
-    if ((ins != NULL) && (out_subscription != NULL) && (tk < CANARD_NUM_TRANSFER_KINDS))
+    if ((ins != NULL) && (out_subscription != NULL) && (tk < CANARD_NUM_TRANSFER_KINDS) &&
+        ((CanardTransferKindMessage == transfer_kind) || (port_id <= CANARD_SERVICE_ID_MAX)))
     {
         // Reset to the initial state. This is absolutely critical because the new payload size limit may be larger
         // than the old value; if there are any payload buffers allocated, we may overrun them because they are shorter
         // than the new payload limit. So we clear the subscription and thus ensure that no overrun may occur.
-        out = canardRxUnsubscribe(ins, transfer_kind, port_id);
+        if ((CanardTransferKindMessage == transfer_kind) &&
+            (ins->_rx_message_count >= CANARD_RX_MESSAGE_SUBSCRIPTIONS_MAX) &&
+            (NULL == rxFindSubscription(ins, transfer_kind, port_id)))
+        {
+            out = -CANARD_ERROR_OUT_OF_MEMORY;  // The message index is full; replacing an existing entry is fine.
+        }
+        else
+        {
+            out = canardRxUnsubscribe(ins, transfer_kind, port_id);
+        }
         if (out >= 0)
         {
             for (size_t i = 0; i < RX_SESSIONS_PER_SUBSCRIPTION; i++)
@@ -1097,7 +1775,21 @@ int8_t canardRxSubscribe(CanardInstance* const       ins,
             out_subscription->_port_id                  = port_id;
             out_subscription->_next                     = ins->_rx_subscriptions[tk];
             ins->_rx_subscriptions[tk]                  = out_subscription;
-            out                                         = (out > 0) ? 0 : 1;
+            if (CanardTransferKindMessage == transfer_kind)
+            {
+                const size_t at = rxMessageLowerBound(ins, port_id);
+                for (size_t i = ins->_rx_message_count; i > at; i--)
+                {
+                    ins->_rx_messages[i] = ins->_rx_messages[i - 1U];
+                }
+                ins->_rx_messages[at] = out_subscription;
+                ins->_rx_message_count++;
+            }
+            else
+            {
+                ins->_rx_services[tk - 1U][port_id] = out_subscription;
+            }
+            out = (out > 0) ? 0 : 1;
         }
     }
     return out;
@@ -1133,6 +1825,22 @@ int8_t canardRxUnsubscribe(CanardInstance* const    ins,
                 ins->_rx_subscriptions[tk] = sub->_next;
             }
 
+            if (CanardTransferKindMessage == transfer_kind)
+            {
+                const size_t at = rxMessageLowerBound(ins, port_id);
+                CANARD_ASSERT((at < ins->_rx_message_count) && (ins->_rx_messages[at] == sub));
+                ins->_rx_message_count--;
+                for (size_t i = at; i < ins->_rx_message_count; i++)
+                {
+                    ins->_rx_messages[i] = ins->_rx_messages[i + 1U];
+                }
+                ins->_rx_messages[ins->_rx_message_count] = NULL;
+            }
+            else
+            {
+                ins->_rx_services[tk - 1U][port_id] = NULL;
+            }
+
             for (size_t i = 0; i < RX_SESSIONS_PER_SUBSCRIPTION; i++)
             {
                 ins->memory_free(ins, (sub->_sessions[i] != NULL) ? sub->_sessions[i]->payload : NULL);
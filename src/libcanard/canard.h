@@ -56,7 +56,7 @@
 /// reception (RX) pipeline.
 ///
 /// The TX and RX pipelines are completely independent from each other except that they both rely on the same
-/// dynamic memory manager. The TX pipeline uses the dynamic memory to store outgoing CAN frames in the prioritized
+/// dynamic memory manager. The TX pipeline uses the dynamic memory to store outgoing transfers in the prioritized
 /// transmission queue. The RX pipeline uses the dynamic memory to store contiguous payload buffers for received
 /// transfers and for keeping the transfer reassembly state machine data. The exact memory consumption model is defined
 /// for both pipelines, so it is possible to statically determine the minimum size of the dynamic memory pool required
@@ -65,11 +65,10 @@
 /// Much like with dynamic memory, the time complexity of every API function is well-characterized, allowing the
 /// application to guarantee predictable real-time performance.
 ///
-/// The TX pipeline is managed with the help of three API functions. When the application needs to emit a transfer,
-/// it invokes canardTxPush(). The function splits the transfer into CAN frames and stores them into the prioritized
-/// transmission queue. The application then picks the CAN frames from the queue one-by-one by calling canardTxPeek()
-/// followed by canardTxPop() -- the former allows the application to look at the frame and the latter tells the library
-/// that the frame shall be removed from the queue. The returned frames need to be deallocated by the application.
+/// The TX pipeline is managed with the help of two API functions. When the application needs to emit a transfer,
+/// it invokes canardTxPush(). The function stores the transfer into the prioritized transmission queue. The application
+/// then takes the CAN frames from the queue one-by-one by calling canardTxEmit(), which generates the next frame
+/// directly into a buffer supplied by the application and removes it from the queue.
 ///
 /// The RX pipeline is managed with the help of three API functions. The main function canardRxAccept() takes a
 /// received CAN frame and updates the appropriate transfer reassembly state machine. The functions canardRxSubscribe()
@@ -145,6 +144,14 @@ extern "C" {
 /// different values per subscription (i.e., per data specifier) depending on its timing requirements.
 #define CANARD_DEFAULT_TRANSFER_ID_TIMEOUT_USEC 2000000UL
 
+/// The maximum number of simultaneous message subscriptions per library instance.
+/// Message subscriptions are indexed in a sorted array of this capacity inside the instance, so the lookup in
+/// canardRxAccept() is logarithmic; service subscriptions are indexed in a direct table and need no such limit.
+/// The application may redefine this to trade instance size for capacity.
+#ifndef CANARD_RX_MESSAGE_SUBSCRIPTIONS_MAX
+#    define CANARD_RX_MESSAGE_SUBSCRIPTIONS_MAX 32U
+#endif
+
 // Forward declarations.
 typedef struct CanardInstance CanardInstance;
 typedef uint64_t              CanardMicrosecond;
@@ -335,20 +342,33 @@ struct CanardInstance
     /// Invalid values are treated as CANARD_NODE_ID_UNSET. The default value is CANARD_NODE_ID_UNSET.
     CanardNodeID node_id;
 
+    /// If set, single-frame transfers are delivered by canardRxAccept() without allocating a payload buffer:
+    /// the transfer payload pointer refers directly to the payload of the input frame, so it is only valid for as long
+    /// as the frame buffer is, and it shall not be passed to memory_free. The application can tell such payloads
+    /// apart by checking whether the pointer lies within the payload of the frame it has passed in.
+    /// Multi-frame transfers are always reassembled into a dynamically allocated buffer.
+    /// The default value is false.
+    bool rx_single_frame_zero_copy;
+
     /// Dynamic memory management callbacks. See their type documentation for details.
     /// They SHALL be valid function pointers at all times.
     /// The time complexity models given in the API documentation are made on the assumption that the memory management
     /// functions have constant complexity O(1).
     ///
     /// The following API functions may allocate memory:   canardRxAccept(), canardTxPush().
-    /// The following API functions may deallocate memory: canardRxAccept(), canardRxSubscribe(), canardRxUnsubscribe().
+    /// The following API functions may deallocate memory: canardRxAccept(), canardRxSubscribe(), canardRxUnsubscribe(),
+    ///                                                    canardTxEmit().
     /// The exact memory requirement and usage model is specified for each function in its documentation.
     CanardMemoryAllocate memory_allocate;
     CanardMemoryFree     memory_free;
 
     /// These fields are for internal use only. Do not access from the application.
     CanardRxSubscription*             _rx_subscriptions[CANARD_NUM_TRANSFER_KINDS];
-    struct CanardInternalTxQueueItem* _tx_queue;
+    CanardRxSubscription*             _rx_services[CANARD_NUM_TRANSFER_KINDS - 1U][CANARD_SERVICE_ID_MAX + 1U];
+    CanardRxSubscription*             _rx_messages[CANARD_RX_MESSAGE_SUBSCRIPTIONS_MAX];  // Sorted by port-ID.
+    size_t                            _rx_message_count;
+    struct CanardInternalTxQueueItem* _tx_queue;  // Transfer of the next frame to transmit.
+    struct CanardInternalTxQueueItem* _tx_root;
 };
 
 /// Construct a new library instance.
@@ -356,20 +376,19 @@ struct CanardInstance
 /// If any of the pointers are NULL, the behavior is undefined.
 ///
 /// The instance does not hold any resources itself except for the allocated memory.
-/// If the instance should be de-initialized, the application shall clear the TX queue by calling the pop function
-/// repeatedly, and remove all RX subscriptions. Once that is done, the instance will be holding no memory resources,
+/// If the instance should be de-initialized, the application shall clear the TX queue by calling canardTxEmit()
+/// until it returns zero, and remove all RX subscriptions. Once that is done, the instance will be holding no memory resources,
 /// so it can be discarded freely.
 ///
 /// The time complexity is constant. This function does not invoke the dynamic memory manager.
 CanardInstance canardInit(const CanardMemoryAllocate memory_allocate, const CanardMemoryFree memory_free);
 
-/// This function serializes a transfer into a sequence of transport frames and inserts them into the prioritized
-/// transmission queue at the appropriate position. Afterwards, the application is supposed to take the enqueued frames
-/// from the transmission queue using the function canardTxPeek() and transmit them. Each transmitted (or otherwise
-/// discarded, e.g., due to timeout) frame should be removed from the queue using canardTxPop(). The queue is
-/// prioritized following the normal CAN frame arbitration rules to avoid the inner priority inversion. The transfer
-/// payload will be copied into the transmission queue so that the lifetime of the frames is not related to the
-/// lifetime of the input transfer instance or its payload buffer.
+/// This function inserts a transfer into the prioritized transmission queue at the appropriate position, to be split
+/// into transport frames as they are taken from the queue. Afterwards, the application is supposed to take the frames
+/// from the transmission queue using the function canardTxEmit() and transmit (or otherwise discard, e.g., due to
+/// timeout) them. The queue is prioritized following the normal CAN frame arbitration rules to avoid the inner
+/// priority inversion. The transfer payload will be copied into the transmission queue so that the lifetime of the
+/// frames is not related to the lifetime of the input transfer instance or its payload buffer.
 ///
 /// The MTU of the generated frames is dependent on the value of the MTU setting at the time when this function
 /// is invoked. The MTU setting can be changed arbitrarily between invocations. No other functions rely on that
@@ -398,21 +417,27 @@ CanardInstance canardInit(const CanardMemoryAllocate memory_allocate, const Cana
 ///     - If the transfer-ID is above the maximum, the excessive bits are silently masked away
 ///       (i.e., the modulo is computed automatically, so the caller doesn't have to bother).
 ///
-/// An out-of-memory error is returned if a TX frame could not be allocated due to the memory being exhausted.
-/// In that case, all previously allocated frames will be deallocated automatically. In other words, either all frames
-/// of the transfer are enqueued successfully, or none are.
+/// An out-of-memory error is returned if the transfer could not be allocated due to the memory being exhausted.
+/// In that case, nothing is enqueued.
 ///
-/// The time complexity is O(p+e), where p is the amount of payload in the transfer, and e is the number of frames
-/// already enqueued in the transmission queue.
+/// The time complexity is O(p+log e), where p is the amount of payload in the transfer, and e is the number of distinct
+/// CAN IDs already enqueued in the transmission queue.
 ///
-/// The memory allocation requirement is one allocation per transport frame. A single-frame transfer takes one
-/// allocation; a multi-frame transfer of N frames takes N allocations. The maximum size of each allocation is
-/// (sizeof(CanardFrame) + sizeof(void*) + MTU).
+/// The memory allocation requirement is one allocation per transfer regardless of the number of its frames.
+/// The size of the allocation is at most (8 * sizeof(void*) + 16 + s), where s is the payload size rounded up to a valid
+/// frame length for single-frame transfers, or the payload size plus the CRC and the padding of the last frame
+/// (less than the MTU) for multi-frame transfers.
 int32_t canardTxPush(CanardInstance* const ins, const CanardTransfer* const transfer);
 
-/// This function accesses the top element of the prioritized transmission queue. The queue itself is not modified
-/// (i.e., the accessed element is not removed). The application should invoke this function to collect the transport
-/// frames of serialized transfers pushed into the prioritized transmission queue by canardTxPush().
+/// This function generates the next frame of the prioritized transmission queue and removes it from the queue.
+/// The application should invoke this function to collect the transport frames of serialized transfers pushed into
+/// the prioritized transmission queue by canardTxPush().
+///
+/// The frame payload is written directly into payload_buffer, which shall be large enough for the MTU that was
+/// configured when the transfer was pushed; CANARD_MTU_CAN_FD bytes are always sufficient. The frame metadata is
+/// stored into out_frame, whose payload pointer is set to payload_buffer. The library keeps no reference to either,
+/// so the application may pass the buffer of its own transmission structure (e.g., the data field of a socket frame)
+/// to avoid copying the frame again.
 ///
 /// Nodes with redundant transports should replicate every frame into each of the transport interfaces.
 /// Such replication may require additional buffering in the media I/O layer, depending on the implementation.
@@ -422,35 +447,18 @@ int32_t canardTxPush(CanardInstance* const ins, const CanardTransfer* const tran
 /// the media layer to implement the discardment of timed-out transport frames. The library does not check it,
 /// so a frame that is already timed out may be returned here.
 ///
-/// If the queue is empty or if the argument is NULL, the returned value is NULL.
-///
-/// If the queue is non-empty, the returned value is a pointer to its top element (i.e., the next frame to transmit).
-/// The returned pointer points to an object allocated in the dynamic storage; it should be eventually freed by the
-/// application by calling CanardInstance::memory_free(). The memory shall not be freed before the entry is removed
-/// from the queue by calling canardTxPop(); this is because until canardTxPop() is executed, the library retains
-/// ownership of the object. The pointer retains validity until explicitly freed by the application; in other words,
-/// calling canardTxPop() does not invalidate the object.
-///
-/// The payload buffer is located shortly after the object itself, in the same memory fragment. The application shall
-/// not attempt to free it.
-///
-/// The time complexity is constant. This function does not invoke the dynamic memory manager.
-const CanardFrame* canardTxPeek(const CanardInstance* const ins);
-
-/// This function transfers the ownership of the top element of the prioritized transmission queue to the application.
-/// The application should invoke this function to remove the top element from the prioritized transmission queue.
-/// The element is removed but it is not invalidated; it is the responsibility of the application to deallocate
-/// the memory used by the object later. The object SHALL NOT be deallocated UNTIL this function is invoked.
-///
 /// WARNING:
-///     Invocation of canardTxPush() may add new elements at the top of the prioritized transmission queue.
-///     The calling code shall take that into account to eliminate the possibility of data loss and memory leak due to
-///     the frame at the top of the queue being unexpectedly replaced between calls of canardTxPeek() and this function.
+///     Invocation of canardTxPush() may add new elements at the top of the prioritized transmission queue, but never
+///     between the frames of a transfer that has started to be emitted, because all frames of a transfer share
+///     the same CAN ID and transfers of equal CAN ID leave the queue in the order they were pushed.
 ///
-/// If the input argument is NULL or if the transmission queue is empty, the function has no effect.
+/// The return value is 1 if a frame was generated, 0 if the queue is empty, or a negated invalid argument error
+/// if any of the arguments are NULL.
 ///
-/// The time complexity is constant. This function does not invoke the dynamic memory manager.
-void canardTxPop(CanardInstance* const ins);
+/// The time complexity is O(p) of the frame payload, plus, when the frame is the last one of its transfer, a logarithmic
+/// term of the number of distinct CAN IDs in the queue unless further transfers with the same CAN ID are enqueued.
+/// After the last frame of a transfer has been generated, its memory is deallocated; this is the only deallocation.
+int8_t canardTxEmit(CanardInstance* const ins, CanardFrame* const out_frame, void* const payload_buffer);
 
 /// This function implements the transfer reassembly logic. It accepts a transport frame, locates the appropriate
 /// subscription state, and, if found, updates it. If the frame completed a transfer, the return value is 1 (one)
@@ -502,12 +510,12 @@ void canardTxPop(CanardInstance* const ins);
 /// for a detailed treatment of the problem and the related theory please refer to the documentation of O1Heap --
 /// a deterministic memory allocator for hard real-time embedded systems.
 ///
-/// The time complexity is O(n+p) where n is the number of subject-IDs or service-IDs subscribed to by the application,
-/// depending on the transfer kind of the supplied frame, and p is the amount of payload in the received frame
-/// (because it will be copied into an internal contiguous buffer). Observe that the time complexity is invariant to
-/// the network configuration (such as the number of online nodes) -- this is a very important design guarantee for
-/// real-time applications because the execution time is dependent only on the number of active subscriptions for
-/// a given transfer kind, and the MTU, both of which are easy to predict and account for. Excepting the
+/// The time complexity is O(log n + p) for message frames, where n is the number of subject-IDs subscribed to by
+/// the application, and O(p) for service frames, whose subscriptions are found through a direct table; p is the amount
+/// of payload in the received frame (because it will be copied into an internal contiguous buffer). Observe that the
+/// time complexity is invariant to the network configuration (such as the number of online nodes) -- this is a very
+/// important design guarantee for real-time applications because the execution time is dependent only on the number
+/// of active message subscriptions and the MTU, both of which are easy to predict and account for. Excepting the
 /// subscription search and the payload data copying, the entire RX pipeline contains neither loops nor recursion.
 /// Misaddressed and malformed frames are discarded in constant time.
 ///
@@ -518,6 +526,8 @@ void canardTxPop(CanardInstance* const ins);
 /// If the extent is zero, the payload pointer may be NULL, since there is no data to store and so a
 /// buffer is not needed. The application is responsible for deallocating the payload buffer when the processing
 /// is done by invoking memory_free on the transfer payload pointer.
+/// The above does not apply to single-frame transfers if rx_single_frame_zero_copy is set on the instance; see its
+/// documentation.
 ///
 /// The function returns a negated out-of-memory error if it was unable to allocate dynamic memory.
 ///
@@ -569,7 +579,10 @@ int8_t canardRxAccept(CanardInstance* const    ins,
 /// The return value is 1 if a new subscription has been created as requested.
 /// The return value is 0 if such subscription existed at the time the function was invoked. In this case,
 /// the existing subscription is terminated and then a new one is created in its place. Pending transfers may be lost.
-/// The return value is a negated invalid argument error if any of the input arguments are invalid.
+/// The return value is a negated invalid argument error if any of the input arguments are invalid, including a
+/// service-ID above CANARD_SERVICE_ID_MAX.
+/// The return value is a negated out-of-memory error if a new message subscription would exceed
+/// CANARD_RX_MESSAGE_SUBSCRIPTIONS_MAX; no subscription is removed in this case.
 ///
 /// The time complexity is linear from the number of current subscriptions under the specified transfer kind.
 /// This function does not allocate new memory. The function may deallocate memory if such subscription already
@@ -2,6 +2,8 @@
 /// Copyright (c) 2016-2020 UAVCAN Development Team.
 /// Author: Pavel Kirienko <pavel.kirienko@zubax.com>
 
+// The definitions below are the generic out-of-line functions that the inline fast paths fall back on.
+#define CANARD_DSDL_CONFIG_NO_FAST_PATHS
 #include "canard_dsdl.h"
 #include <assert.h>
 #include <float.h>
@@ -106,6 +106,114 @@ CanardDSDLFloat32 canardDSDLGetF16(const uint8_t* const buf, const size_t buf_si
 CanardDSDLFloat32 canardDSDLGetF32(const uint8_t* const buf, const size_t buf_size, const size_t off_bit);
 CanardDSDLFloat64 canardDSDLGetF64(const uint8_t* const buf, const size_t buf_size, const size_t off_bit);
 
+/// Inline fast paths for the most common case of byte-aligned fields whose length is a whole number of bytes.
+/// Such fields are loaded and stored as little-endian byte sequences without going through canardDSDLCopyBits();
+/// any other field, or a field that is not entirely within the source buffer, is handed to the generic functions
+/// declared above, so the results are identical. When the offset and the length are compile-time constants, the
+/// check is resolved by the compiler and only one of the paths remains; otherwise it costs a few instructions.
+/// Fields of at most 8 bits that do not cross a byte boundary take the fast path even if they are not aligned.
+///
+/// The functions above are still available by their names, e.g., for taking their address or to bypass the fast
+/// paths with (canardDSDLGetU8)(...). Define CANARD_DSDL_CONFIG_NO_FAST_PATHS to disable the fast paths entirely.
+#ifndef CANARD_DSDL_CONFIG_NO_FAST_PATHS
+
+/// True if the field starts at a byte boundary, spans whole bytes not exceeding max_len_bit, and fits into the buffer.
+static inline bool canardDSDLIsByteAligned(const size_t  buf_size,
+                                           const size_t  off_bit,
+                                           const uint8_t len_bit,
+                                           const uint8_t max_len_bit)
+{
+    return ((off_bit % 8U) == 0U) && ((len_bit % 8U) == 0U) && (len_bit <= max_len_bit) &&
+           ((len_bit / 8U) <= buf_size) && ((off_bit / 8U) <= (buf_size - (len_bit / 8U)));
+}
+
+static inline uint64_t canardDSDLLoadLE(const uint8_t* const buf, const size_t off_bit, const uint8_t len_bit)
+{
+    const uint8_t* const p   = &buf[off_bit / 8U];
+    uint64_t             out = 0U;
+    for (uint8_t i = 0U; i < (len_bit / 8U); i++)
+    {
+        out |= ((uint64_t) p[i]) << (8U * i);
+    }
+    return out;
+}
+
+static inline uint8_t canardDSDLGetU8Inline(const uint8_t* const buf,
+                                            const size_t         buf_size,
+                                            const size_t         off_bit,
+                                            const uint8_t        len_bit)
+{
+    if ((len_bit <= 8U) && (((off_bit % 8U) + len_bit) <= 8U) && ((off_bit / 8U) < buf_size))
+    {
+        return (uint8_t)((uint8_t)(buf[off_bit / 8U] >> (off_bit % 8U)) & (uint8_t)((1U << len_bit) - 1U));
+    }
+    return canardDSDLGetU8(buf, buf_size, off_bit, len_bit);
+}
+
+static inline uint16_t canardDSDLGetU16Inline(const uint8_t* const buf,
+                                              const size_t         buf_size,
+                                              const size_t         off_bit,
+                                              const uint8_t        len_bit)
+{
+    if (canardDSDLIsByteAligned(buf_size, off_bit, len_bit, 16U))
+    {
+        return (uint16_t) canardDSDLLoadLE(buf, off_bit, len_bit);
+    }
+    return canardDSDLGetU16(buf, buf_size, off_bit, len_bit);
+}
+
+static inline uint32_t canardDSDLGetU32Inline(const uint8_t* const buf,
+                                              const size_t         buf_size,
+                                              const size_t         off_bit,
+                                              const uint8_t        len_bit)
+{
+    if (canardDSDLIsByteAligned(buf_size, off_bit, len_bit, 32U))
+    {
+        return (uint32_t) canardDSDLLoadLE(buf, off_bit, len_bit);
+    }
+    return canardDSDLGetU32(buf, buf_size, off_bit, len_bit);
+}
+
+static inline uint64_t canardDSDLGetU64Inline(const uint8_t* const buf,
+                                              const size_t         buf_size,
+                                              const size_t         off_bit,
+                                              const uint8_t        len_bit)
+{
+    if (canardDSDLIsByteAligned(buf_size, off_bit, len_bit, 64U))
+    {
+        return canardDSDLLoadLE(buf, off_bit, len_bit);
+    }
+    return canardDSDLGetU64(buf, buf_size, off_bit, len_bit);
+}
+
+/// The destination size is not known to the setters, so like the generic function this relies on the caller.
+static inline void canardDSDLSetUxxInline(uint8_t* const  buf,
+                                          const size_t    off_bit,
+                                          const uint64_t  value,
+                                          const uint8_t   len_bit)
+{
+    if (((off_bit % 8U) == 0U) && ((len_bit % 8U) == 0U) && (len_bit <= 64U))
+    {
+        uint8_t* const p = &buf[off_bit / 8U];
+        for (uint8_t i = 0U; i < (len_bit / 8U); i++)
+        {
+            p[i] = (uint8_t)(value >> (8U * i));
+        }
+    }
+    else
+    {
+        canardDSDLSetUxx(buf, off_bit, value, len_bit);
+    }
+}
+
+#    define canardDSDLGetU8(buf, buf_size, off_bit, len_bit) canardDSDLGetU8Inline(buf, buf_size, off_bit, len_bit)
+#    define canardDSDLGetU16(buf, buf_size, off_bit, len_bit) canardDSDLGetU16Inline(buf, buf_size, off_bit, len_bit)
+#    define canardDSDLGetU32(buf, buf_size, off_bit, len_bit) canardDSDLGetU32Inline(buf, buf_size, off_bit, len_bit)
+#    define canardDSDLGetU64(buf, buf_size, off_bit, len_bit) canardDSDLGetU64Inline(buf, buf_size, off_bit, len_bit)
+#    define canardDSDLSetUxx(buf, off_bit, value, len_bit) canardDSDLSetUxxInline(buf, off_bit, value, len_bit)
+
+#endif  // CANARD_DSDL_CONFIG_NO_FAST_PATHS
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "schema.h"
+#include "slab.h"
+#include "wlmio.h"
+
+
+// Internal accessors for the module helpers and blocking wrappers, which sit outside wlmio.c and
+// cannot see the layout of struct wlmio_ctx.
+
+// All timeouts share one timerfd. Pending timers are kept in a binary min-heap ordered by
+// deadline and the timerfd is only re-armed when a timer earlier than the armed deadline is
+// scheduled, or after it fires. Cancelling the earliest timer leaves the timerfd armed; the
+// resulting early wakeup finds nothing expired and re-arms for the new earliest deadline.
+struct timer_entry
+{
+	uint64_t deadline;
+	size_t index;
+	void (* handler)(struct wlmio_ctx*, struct timer_entry*);
+};
+
+#define TIMER_UNSCHEDULED SIZE_MAX
+
+
+/**
+ * @return Returns the context used by the functions without a context argument, NULL before
+ * wlmio_init()
+*/
+struct wlmio_ctx* wlmio_default_ctx(void);
+
+/**
+ * @return Returns the slab request contexts of ctx are allocated from
+*/
+struct slab* wlmio_ctx_slab(struct wlmio_ctx* ctx);
+
+/**
+ * @return Returns the slab of ctx for contexts of up to SLAB_LARGE_OBJECT_SIZE bytes, such as a
+ * read of a whole register group
+*/
+struct slab* wlmio_ctx_group_slab(struct wlmio_ctx* ctx);
+
+/**
+ * @return Returns the register schemas known to ctx
+*/
+struct schema_cache* wlmio_ctx_schema_cache(struct wlmio_ctx* ctx);
+
+/**
+ * @return Returns CLOCK_MONOTONIC in microseconds, the time base of timer deadlines
+*/
+uint64_t wlmio_ctx_monotonic_usec(void);
+
+/**
+ * Timers on the context's timer heap, for use from the event loop thread only. The handler is
+ * called once per schedule from wlmio_tick()/wlmio_tick_ctx(), a timer is not rescheduled
+ * automatically.
+*/
+void wlmio_ctx_timer_init(struct timer_entry* timer, void (* handler)(struct wlmio_ctx*, struct timer_entry*));
+int32_t wlmio_ctx_timer_schedule(struct wlmio_ctx* ctx, struct timer_entry* timer, uint64_t deadline);
+void wlmio_ctx_timer_cancel(struct wlmio_ctx* ctx, struct timer_entry* timer);
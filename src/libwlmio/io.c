@@ -7,6 +7,8 @@
 
 #include <canard.h>
 
+#include "context.h"
+#include "slab.h"
 #include "wlmio.h"
 
 
@@ -14,6 +16,7 @@ struct vpe6010_read
 {
   struct wlmio_register_access reg;
   struct wlmio_vpe6010_input* input;
+  struct wlmio_ctx* ctx;
   void (* callback)(int32_t r, void* uparam);
   void* uparam;
 };
@@ -43,23 +46,28 @@ static void vpe6010_read_callback(int32_t r, void* const p)
 
 exit:
   t->callback(r, t->uparam);
-  free(p);
+  slab_free(wlmio_ctx_slab(t->ctx), p);
 }
 
 
-int32_t wlmio_vpe6010_read(const uint8_t node_id, struct wlmio_vpe6010_input* const dst, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+int32_t wlmio_vpe6010_read_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, struct wlmio_vpe6010_input* const dst, void (* const callback)(int32_t r, void* uparam), void* const uparam)
 {
 	if(node_id > CANARD_NODE_ID_MAX || dst == NULL) { return -EINVAL; }
 
-  struct vpe6010_read* t = malloc(sizeof(struct vpe6010_read));
+  struct vpe6010_read* t;
+  int32_t r = slab_alloc(wlmio_ctx_slab(ctx), sizeof(struct vpe6010_read), (void**)&t);
+  if(r < 0)
+  { return r; }
+
+  t->ctx = ctx;
   t->input = dst;
   t->callback = callback;
   t->uparam = uparam;
 
-	int32_t r = wlmio_register_access(node_id, "input", NULL, &t->reg, &vpe6010_read_callback, t);
+	r = wlmio_register_access_ctx(ctx, node_id, "input", NULL, &t->reg, &vpe6010_read_callback, t);
   if(r < 0)
   {
-    free(t);
+    slab_free(wlmio_ctx_slab(ctx), t);
     goto exit;
   }
 
@@ -70,7 +78,13 @@ exit:
 }
 
 
-int32_t wlmio_vpe6030_write(const uint8_t node_id, const uint8_t ch, uint8_t v, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+int32_t wlmio_vpe6010_read(const uint8_t node_id, struct wlmio_vpe6010_input* const dst, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	return wlmio_vpe6010_read_ctx(wlmio_default_ctx(), node_id, dst, callback, uparam);
+}
+
+
+int64_t wlmio_vpe6030_write_ex_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint8_t ch, uint8_t v, const struct wlmio_request_options* const opts, void (* const callback)(int32_t r, void* uparam), void* const uparam)
 {
 	if(node_id > CANARD_NODE_ID_MAX || ch > 3) { return -EINVAL; }
 
@@ -103,16 +117,109 @@ int32_t wlmio_vpe6030_write(const uint8_t node_id, const uint8_t ch, uint8_t v,
       break;
   }
 
-	int32_t r = wlmio_register_access(node_id, name, &regw, NULL, callback, uparam);
+	const int64_t r = wlmio_register_access_ex_ctx(ctx, node_id, name, &regw, NULL, opts, callback, uparam);
 
 	return r;
 }
 
 
+int32_t wlmio_vpe6030_write_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint8_t ch, const uint8_t v, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	const int64_t r = wlmio_vpe6030_write_ex_ctx(ctx, node_id, ch, v, NULL, callback, uparam);
+	return r < 0 ? r : 0;
+}
+
+
+int32_t wlmio_vpe6030_write(const uint8_t node_id, const uint8_t ch, uint8_t v, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	return wlmio_vpe6030_write_ctx(wlmio_default_ctx(), node_id, ch, v, callback, uparam);
+}
+
+
+int64_t wlmio_vpe6030_write_ex(const uint8_t node_id, const uint8_t ch, uint8_t v, const struct wlmio_request_options* const opts, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	return wlmio_vpe6030_write_ex_ctx(wlmio_default_ctx(), node_id, ch, v, opts, callback, uparam);
+}
+
+
+// Reads the uint16 chN.input register of every channel of a module as one register group. The
+// context holds a response buffer per channel, so it comes from the group slab of the context.
+struct input_read_all
+{
+  struct wlmio_ctx* ctx;
+  struct wlmio_register_op ops[8];
+  struct wlmio_register_access regs[8];
+  uint16_t* input;
+  uint8_t channels;
+  void (* callback)(int32_t r, void* uparam);
+  void* uparam;
+};
+
+static const char* const input_names[8] =
+{
+  "ch1.input", "ch2.input", "ch3.input", "ch4.input",
+  "ch5.input", "ch6.input", "ch7.input", "ch8.input"
+};
+
+
+static void input_read_all_callback(int32_t r, void* const p)
+{
+  struct input_read_all* const t = p;
+
+  for(uint8_t i = 0; i < t->channels; i += 1)
+  {
+    if(t->ops[i].status < 0)
+    { continue; }
+
+    if(t->regs[i].type != WLMIO_REGISTER_VALUE_UINT16 || t->regs[i].length < 1)
+    {
+      r = r < 0 ? r : -EPROTO;
+      continue;
+    }
+
+    memcpy(&t->input[i], t->regs[i].value, 2);
+  }
+
+  t->callback(r, t->uparam);
+  slab_free(wlmio_ctx_group_slab(t->ctx), t);
+}
+
+
+static int32_t input_read_all(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint8_t channels, uint16_t* const v, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+  if(node_id > CANARD_NODE_ID_MAX || v == NULL || callback == NULL) { return -EINVAL; }
+
+  struct input_read_all* t;
+  int32_t r = slab_alloc(wlmio_ctx_group_slab(ctx), sizeof(struct input_read_all), (void**)&t);
+  if(r < 0)
+  { return r; }
+
+  t->ctx = ctx;
+  t->input = v;
+  t->channels = channels;
+  t->callback = callback;
+  t->uparam = uparam;
+
+  for(uint8_t i = 0; i < channels; i += 1)
+  {
+    t->ops[i].name = input_names[i];
+    t->ops[i].regw = NULL;
+    t->ops[i].regr = &t->regs[i];
+  }
+
+  r = wlmio_register_access_many_ctx(ctx, node_id, t->ops, channels, &input_read_all_callback, t);
+  if(r < 0)
+  { slab_free(wlmio_ctx_group_slab(ctx), t); }
+
+  return r;
+}
+
+
 struct vpe6040_read
 {
   struct wlmio_register_access reg;
   uint16_t* input;
+  struct wlmio_ctx* ctx;
   void (* callback)(int32_t r, void* uparam);
   void* uparam;
 };
@@ -137,15 +244,20 @@ static void vpe6040_read_callback(int32_t r, void* const p)
 
 exit:
   t->callback(r, t->uparam);
-  free(p);
+  slab_free(wlmio_ctx_slab(t->ctx), p);
 }
 
 
-int32_t wlmio_vpe6040_read(const uint8_t node_id, const uint8_t ch, uint16_t* const v, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+int32_t wlmio_vpe6040_read_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint8_t ch, uint16_t* const v, void (* const callback)(int32_t r, void* uparam), void* const uparam)
 {
   if(node_id > CANARD_NODE_ID_MAX || ch > 3 || v == NULL || callback == NULL) { return -EINVAL; }
 
-  struct vpe6040_read* t = malloc(sizeof(struct vpe6040_read));
+  struct vpe6040_read* t;
+  int32_t r = slab_alloc(wlmio_ctx_slab(ctx), sizeof(struct vpe6040_read), (void**)&t);
+  if(r < 0)
+  { return r; }
+
+  t->ctx = ctx;
   t->input = v;
   t->callback = callback;
   t->uparam = uparam;
@@ -169,10 +281,10 @@ int32_t wlmio_vpe6040_read(const uint8_t node_id, const uint8_t ch, uint16_t* co
       name = "ch4.input";
       break;
   }
-	int32_t r = wlmio_register_access(node_id, name, NULL, &t->reg, &vpe6040_read_callback, t);
+	r = wlmio_register_access_ctx(ctx, node_id, name, NULL, &t->reg, &vpe6040_read_callback, t);
   if(r < 0)
   {
-    free(t);
+    slab_free(wlmio_ctx_slab(ctx), t);
     goto exit;
   }
 
@@ -183,7 +295,25 @@ exit:
 }
 
 
-int32_t wlmio_vpe6040_configure(const uint8_t node_id, const uint8_t ch, const uint8_t mode, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+int32_t wlmio_vpe6040_read(const uint8_t node_id, const uint8_t ch, uint16_t* const v, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	return wlmio_vpe6040_read_ctx(wlmio_default_ctx(), node_id, ch, v, callback, uparam);
+}
+
+
+int32_t wlmio_vpe6040_read_all_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, uint16_t* const v, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+  return input_read_all(ctx, node_id, 4, v, callback, uparam);
+}
+
+
+int32_t wlmio_vpe6040_read_all(const uint8_t node_id, uint16_t* const v, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	return wlmio_vpe6040_read_all_ctx(wlmio_default_ctx(), node_id, v, callback, uparam);
+}
+
+
+int32_t wlmio_vpe6040_configure_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint8_t ch, const uint8_t mode, void (* const callback)(int32_t r, void* uparam), void* const uparam)
 {
   if(node_id > CANARD_NODE_ID_MAX || ch > 3 || mode > WLMIO_VPE6040_MODE_10V || callback == NULL) { return -EINVAL; }
 
@@ -214,13 +344,19 @@ int32_t wlmio_vpe6040_configure(const uint8_t node_id, const uint8_t ch, const u
       break;
   }
 
-	int32_t r = wlmio_register_access(node_id, name, &regw, NULL, callback, uparam);
+	int32_t r = wlmio_register_access_ctx(ctx, node_id, name, &regw, NULL, callback, uparam);
 
 	return r;
 }
 
 
-int32_t wlmio_vpe6050_write(const uint8_t node_id, const uint8_t ch, const uint16_t v, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+int32_t wlmio_vpe6040_configure(const uint8_t node_id, const uint8_t ch, const uint8_t mode, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	return wlmio_vpe6040_configure_ctx(wlmio_default_ctx(), node_id, ch, mode, callback, uparam);
+}
+
+
+int64_t wlmio_vpe6050_write_ex_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint8_t ch, const uint16_t v, const struct wlmio_request_options* const opts, void (* const callback)(int32_t r, void* uparam), void* const uparam)
 {
   if(node_id > CANARD_NODE_ID_MAX || ch > 3 || callback == NULL) { return -EINVAL; }
 
@@ -251,13 +387,32 @@ int32_t wlmio_vpe6050_write(const uint8_t node_id, const uint8_t ch, const uint1
       break;
   }
 
-	int32_t r = wlmio_register_access(node_id, name, &regw, NULL, callback, uparam);
+	const int64_t r = wlmio_register_access_ex_ctx(ctx, node_id, name, &regw, NULL, opts, callback, uparam);
 
 	return r;
 }
 
 
-int32_t wlmio_vpe6050_configure(const uint8_t node_id, const uint8_t ch, const uint8_t mode, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+int32_t wlmio_vpe6050_write_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint8_t ch, const uint16_t v, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	const int64_t r = wlmio_vpe6050_write_ex_ctx(ctx, node_id, ch, v, NULL, callback, uparam);
+	return r < 0 ? r : 0;
+}
+
+
+int32_t wlmio_vpe6050_write(const uint8_t node_id, const uint8_t ch, const uint16_t v, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	return wlmio_vpe6050_write_ctx(wlmio_default_ctx(), node_id, ch, v, callback, uparam);
+}
+
+
+int64_t wlmio_vpe6050_write_ex(const uint8_t node_id, const uint8_t ch, const uint16_t v, const struct wlmio_request_options* const opts, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	return wlmio_vpe6050_write_ex_ctx(wlmio_default_ctx(), node_id, ch, v, opts, callback, uparam);
+}
+
+
+int32_t wlmio_vpe6050_configure_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint8_t ch, const uint8_t mode, void (* const callback)(int32_t r, void* uparam), void* const uparam)
 {
   if(node_id > CANARD_NODE_ID_MAX || ch > 3 || mode > WLMIO_VPE6050_MODE_SINK || callback == NULL) { return -EINVAL; }
 
@@ -288,16 +443,23 @@ int32_t wlmio_vpe6050_configure(const uint8_t node_id, const uint8_t ch, const u
       break;
   }
 
-	int32_t r = wlmio_register_access(node_id, name, &regw, NULL, callback, uparam);
+	int32_t r = wlmio_register_access_ctx(ctx, node_id, name, &regw, NULL, callback, uparam);
 
 	return r;
 }
 
 
+int32_t wlmio_vpe6050_configure(const uint8_t node_id, const uint8_t ch, const uint8_t mode, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	return wlmio_vpe6050_configure_ctx(wlmio_default_ctx(), node_id, ch, mode, callback, uparam);
+}
+
+
 struct vpe6060_read
 {
   struct wlmio_register_access reg;
   uint32_t* input;
+  struct wlmio_ctx* ctx;
   void (* callback)(int32_t r, void* uparam);
   void* uparam;
 };
@@ -322,15 +484,20 @@ static void vpe6060_read_callback(int32_t r, void* const p)
 
 exit:
   t->callback(r, t->uparam);
-  free(p);
+  slab_free(wlmio_ctx_slab(t->ctx), p);
 }
 
 
-int32_t wlmio_vpe6060_read(const uint8_t node_id, const uint8_t ch, uint32_t* const v, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+int32_t wlmio_vpe6060_read_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint8_t ch, uint32_t* const v, void (* const callback)(int32_t r, void* uparam), void* const uparam)
 {
   if(node_id > CANARD_NODE_ID_MAX || ch > 3 || v == NULL || callback == NULL) { return -EINVAL; }
 
-  struct vpe6060_read* t = malloc(sizeof(struct vpe6060_read));
+  struct vpe6060_read* t;
+  int32_t r = slab_alloc(wlmio_ctx_slab(ctx), sizeof(struct vpe6060_read), (void**)&t);
+  if(r < 0)
+  { return r; }
+
+  t->ctx = ctx;
   t->input = v;
   t->callback = callback;
   t->uparam = uparam;
@@ -354,10 +521,10 @@ int32_t wlmio_vpe6060_read(const uint8_t node_id, const uint8_t ch, uint32_t* co
       name = "ch4.input";
       break;
   }
-	int32_t r = wlmio_register_access(node_id, name, NULL, &t->reg, &vpe6060_read_callback, t);
+	r = wlmio_register_access_ctx(ctx, node_id, name, NULL, &t->reg, &vpe6060_read_callback, t);
   if(r < 0)
   {
-    free(t);
+    slab_free(wlmio_ctx_slab(ctx), t);
     goto exit;
   }
 
@@ -368,11 +535,18 @@ exit:
 }
 
 
+int32_t wlmio_vpe6060_read(const uint8_t node_id, const uint8_t ch, uint32_t* const v, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	return wlmio_vpe6060_read_ctx(wlmio_default_ctx(), node_id, ch, v, callback, uparam);
+}
+
+
 struct vpe6060_configure
 {
   uint8_t counter;
   uint8_t cancelled;
   int32_t r;
+  struct wlmio_ctx* ctx;
   void (* callback)(int32_t r, void* uparam);
   void* uparam;
 };
@@ -391,15 +565,20 @@ static void vpe6060_configure_callback(int32_t r, void* const p)
   { return; }
 
   t->callback(t->r, t->uparam);
-  free(p);
+  slab_free(wlmio_ctx_slab(t->ctx), p);
 }
 
 
-int32_t wlmio_vpe6060_configure(const uint8_t node_id, const uint8_t ch, const uint8_t mode, const uint8_t polarity, const uint8_t bias, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+int32_t wlmio_vpe6060_configure_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint8_t ch, const uint8_t mode, const uint8_t polarity, const uint8_t bias, void (* const callback)(int32_t r, void* uparam), void* const uparam)
 {
   if(node_id > CANARD_NODE_ID_MAX || ch > 3 || mode > WLMIO_VPE6060_MODE_PULSE_COUNTER || polarity > WLMIO_VPE6060_POLARITY_FALLING || bias > WLMIO_VPE6060_BIAS_NPN || callback == NULL) { return -EINVAL; }
 
-  struct vpe6060_configure* t = malloc(sizeof(struct vpe6060_configure));
+  struct vpe6060_configure* t;
+  int32_t r = slab_alloc(wlmio_ctx_slab(ctx), sizeof(struct vpe6060_configure), (void**)&t);
+  if(r < 0)
+  { return r; }
+
+  t->ctx = ctx;
   t->counter = 0;
   t->cancelled = 0;
   t->r = 0;
@@ -443,16 +622,16 @@ int32_t wlmio_vpe6060_configure(const uint8_t node_id, const uint8_t ch, const u
 
   memcpy(regw.value, &mode, 1);
 
-	int32_t r = wlmio_register_access(node_id, mode_name, &regw, NULL, vpe6060_configure_callback, t);
+	r = wlmio_register_access_ctx(ctx, node_id, mode_name, &regw, NULL, vpe6060_configure_callback, t);
   if(r < 0)
   {
-    free(t);
+    slab_free(wlmio_ctx_slab(ctx), t);
     goto exit;
   }
 
   memcpy(regw.value, &polarity, 1);
 
-  r = wlmio_register_access(node_id, polarity_name, &regw, NULL, vpe6060_configure_callback, t);
+  r = wlmio_register_access_ctx(ctx, node_id, polarity_name, &regw, NULL, vpe6060_configure_callback, t);
   if(r < 0)
   {
     t->cancelled += 1;
@@ -461,7 +640,7 @@ int32_t wlmio_vpe6060_configure(const uint8_t node_id, const uint8_t ch, const u
 
   memcpy(regw.value, &bias, 1);
 
-  r = wlmio_register_access(node_id, bias_name, &regw, NULL, vpe6060_configure_callback, t);
+  r = wlmio_register_access_ctx(ctx, node_id, bias_name, &regw, NULL, vpe6060_configure_callback, t);
   if(r < 0)
   {
     t->cancelled += 1;
@@ -475,7 +654,13 @@ exit:
 }
 
 
-int32_t wlmio_vpe6070_write(const uint8_t node_id, const uint8_t ch, const uint16_t v, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+int32_t wlmio_vpe6060_configure(const uint8_t node_id, const uint8_t ch, const uint8_t mode, const uint8_t polarity, const uint8_t bias, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	return wlmio_vpe6060_configure_ctx(wlmio_default_ctx(), node_id, ch, mode, polarity, bias, callback, uparam);
+}
+
+
+int64_t wlmio_vpe6070_write_ex_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint8_t ch, const uint16_t v, const struct wlmio_request_options* const opts, void (* const callback)(int32_t r, void* uparam), void* const uparam)
 {
   if(node_id > CANARD_NODE_ID_MAX || ch > 3 || callback == NULL) { return -EINVAL; }
 
@@ -506,16 +691,36 @@ int32_t wlmio_vpe6070_write(const uint8_t node_id, const uint8_t ch, const uint1
       break;
   }
 
-	int32_t r = wlmio_register_access(node_id, name, &regw, NULL, callback, uparam);
+	const int64_t r = wlmio_register_access_ex_ctx(ctx, node_id, name, &regw, NULL, opts, callback, uparam);
 
 	return r;
 }
 
 
+int32_t wlmio_vpe6070_write_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint8_t ch, const uint16_t v, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	const int64_t r = wlmio_vpe6070_write_ex_ctx(ctx, node_id, ch, v, NULL, callback, uparam);
+	return r < 0 ? r : 0;
+}
+
+
+int32_t wlmio_vpe6070_write(const uint8_t node_id, const uint8_t ch, const uint16_t v, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	return wlmio_vpe6070_write_ctx(wlmio_default_ctx(), node_id, ch, v, callback, uparam);
+}
+
+
+int64_t wlmio_vpe6070_write_ex(const uint8_t node_id, const uint8_t ch, const uint16_t v, const struct wlmio_request_options* const opts, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	return wlmio_vpe6070_write_ex_ctx(wlmio_default_ctx(), node_id, ch, v, opts, callback, uparam);
+}
+
+
 struct vpe6080_read
 {
   struct wlmio_register_access reg;
   uint16_t* input;
+  struct wlmio_ctx* ctx;
   void (* callback)(int32_t r, void* uparam);
   void* uparam;
 };
@@ -540,15 +745,20 @@ static void vpe6080_read_callback(int32_t r, void* const p)
 
 exit:
   t->callback(r, t->uparam);
-  free(p);
+  slab_free(wlmio_ctx_slab(t->ctx), p);
 }
 
 
-int32_t wlmio_vpe6080_read(const uint8_t node_id, const uint8_t ch, uint16_t* const v, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+int32_t wlmio_vpe6080_read_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint8_t ch, uint16_t* const v, void (* const callback)(int32_t r, void* uparam), void* const uparam)
 {
   if(node_id > CANARD_NODE_ID_MAX || ch > 7 || v == NULL || callback == NULL) { return -EINVAL; }
 
-  struct vpe6080_read* t = malloc(sizeof(struct vpe6080_read));
+  struct vpe6080_read* t;
+  int32_t r = slab_alloc(wlmio_ctx_slab(ctx), sizeof(struct vpe6080_read), (void**)&t);
+  if(r < 0)
+  { return r; }
+
+  t->ctx = ctx;
   t->input = v;
   t->callback = callback;
   t->uparam = uparam;
@@ -588,10 +798,10 @@ int32_t wlmio_vpe6080_read(const uint8_t node_id, const uint8_t ch, uint16_t* co
       name = "ch8.input";
       break;
   }
-	int32_t r = wlmio_register_access(node_id, name, NULL, &t->reg, &vpe6080_read_callback, t);
+	r = wlmio_register_access_ctx(ctx, node_id, name, NULL, &t->reg, &vpe6080_read_callback, t);
   if(r < 0)
   {
-    free(t);
+    slab_free(wlmio_ctx_slab(ctx), t);
     goto exit;
   }
 
@@ -602,11 +812,30 @@ exit:
 }
 
 
+int32_t wlmio_vpe6080_read(const uint8_t node_id, const uint8_t ch, uint16_t* const v, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	return wlmio_vpe6080_read_ctx(wlmio_default_ctx(), node_id, ch, v, callback, uparam);
+}
+
+
+int32_t wlmio_vpe6080_read_all_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, uint16_t* const v, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+  return input_read_all(ctx, node_id, 8, v, callback, uparam);
+}
+
+
+int32_t wlmio_vpe6080_read_all(const uint8_t node_id, uint16_t* const v, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	return wlmio_vpe6080_read_all_ctx(wlmio_default_ctx(), node_id, v, callback, uparam);
+}
+
+
 struct vpe6080_configure
 {
   uint8_t counter;
   uint8_t cancelled;
   int32_t r;
+  struct wlmio_ctx* ctx;
   void (* callback)(int32_t r, void* uparam);
   void* uparam;
 };
@@ -625,17 +854,22 @@ static void vpe6080_configure_callback(int32_t r, void* const p)
   { return; }
 
   t->callback(t->r, t->uparam);
-  free(p);
+  slab_free(wlmio_ctx_slab(t->ctx), p);
 }
 
 
-int32_t wlmio_vpe6080_configure(const uint8_t node_id, const uint8_t ch, uint8_t enabled, const uint16_t beta, const uint16_t t0, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+int32_t wlmio_vpe6080_configure_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint8_t ch, uint8_t enabled, const uint16_t beta, const uint16_t t0, void (* const callback)(int32_t r, void* uparam), void* const uparam)
 {
   if(node_id > CANARD_NODE_ID_MAX || ch > 7 || callback == NULL) { return -EINVAL; }
 
   enabled = enabled ? 1 : 0;
 
-  struct vpe6080_configure* t = malloc(sizeof(struct vpe6080_configure));
+  struct vpe6080_configure* t;
+  int32_t r = slab_alloc(wlmio_ctx_slab(ctx), sizeof(struct vpe6080_configure), (void**)&t);
+  if(r < 0)
+  { return r; }
+
+  t->ctx = ctx;
   t->counter = 0;
   t->cancelled = 0;
   t->r = 0;
@@ -703,17 +937,17 @@ int32_t wlmio_vpe6080_configure(const uint8_t node_id, const uint8_t ch, uint8_t
 
   memcpy(regw.value, &enabled, 1);
 
-	int32_t r = wlmio_register_access(node_id, enable_name, &regw, NULL, vpe6080_configure_callback, t);
+	r = wlmio_register_access_ctx(ctx, node_id, enable_name, &regw, NULL, vpe6080_configure_callback, t);
   if(r < 0)
   {
-    free(t);
+    slab_free(wlmio_ctx_slab(ctx), t);
     goto exit;
   }
 
   regw.type = WLMIO_REGISTER_VALUE_UINT16;
   memcpy(regw.value, &beta, 2);
 
-  r = wlmio_register_access(node_id, beta_name, &regw, NULL, vpe6080_configure_callback, t);
+  r = wlmio_register_access_ctx(ctx, node_id, beta_name, &regw, NULL, vpe6080_configure_callback, t);
   if(r < 0)
   {
     t->cancelled += 1;
@@ -722,7 +956,7 @@ int32_t wlmio_vpe6080_configure(const uint8_t node_id, const uint8_t ch, uint8_t
 
   memcpy(regw.value, &t0, 2);
 
-  r = wlmio_register_access(node_id, t0_name, &regw, NULL, vpe6080_configure_callback, t);
+  r = wlmio_register_access_ctx(ctx, node_id, t0_name, &regw, NULL, vpe6080_configure_callback, t);
   if(r < 0)
   {
     t->cancelled += 1;
@@ -736,10 +970,17 @@ exit:
 }
 
 
+int32_t wlmio_vpe6080_configure(const uint8_t node_id, const uint8_t ch, uint8_t enabled, const uint16_t beta, const uint16_t t0, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	return wlmio_vpe6080_configure_ctx(wlmio_default_ctx(), node_id, ch, enabled, beta, t0, callback, uparam);
+}
+
+
 struct node_set_sample_interval
 {
   struct wlmio_register_access regr;
   uint16_t sample_interval;
+  struct wlmio_ctx* ctx;
   void (* callback)(int32_t r, void* uparam);
   void* uparam;
 };
@@ -771,15 +1012,20 @@ static void node_set_sample_interval_callback(int32_t r, void* const p)
 
 exit:
   t->callback(r, t->uparam);
-  free(p);
+  slab_free(wlmio_ctx_slab(t->ctx), p);
 }
 
 
-int32_t wlmio_node_set_sample_interval(const uint8_t node_id, const uint16_t sample_interval, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+int32_t wlmio_node_set_sample_interval_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint16_t sample_interval, void (* const callback)(int32_t r, void* uparam), void* const uparam)
 {
   if(node_id > CANARD_NODE_ID_MAX || callback == NULL) { return -EINVAL; }
 
-  struct node_set_sample_interval* t = malloc(sizeof(struct node_set_sample_interval));
+  struct node_set_sample_interval* t;
+  int32_t r = slab_alloc(wlmio_ctx_slab(ctx), sizeof(struct node_set_sample_interval), (void**)&t);
+  if(r < 0)
+  { return r; }
+
+  t->ctx = ctx;
   t->callback = callback;
   t->uparam = uparam;
 
@@ -789,10 +1035,10 @@ int32_t wlmio_node_set_sample_interval(const uint8_t node_id, const uint16_t sam
 	regw.length = 1;
   memcpy(regw.value, &sample_interval, 2);
 
-	int32_t r = wlmio_register_access(node_id, "sample_interval", &regw, &t->regr, node_set_sample_interval_callback, t);
+	r = wlmio_register_access_ctx(ctx, node_id, "sample_interval", &regw, &t->regr, node_set_sample_interval_callback, t);
   if(r < 0)
   {
-    free(t);
+    slab_free(wlmio_ctx_slab(ctx), t);
     goto exit;
   }
 
@@ -803,10 +1049,17 @@ exit:
 }
 
 
+int32_t wlmio_node_set_sample_interval(const uint8_t node_id, const uint16_t sample_interval, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	return wlmio_node_set_sample_interval_ctx(wlmio_default_ctx(), node_id, sample_interval, callback, uparam);
+}
+
+
 struct vpe6090_read
 {
   struct wlmio_register_access reg;
   uint16_t* input;
+  struct wlmio_ctx* ctx;
   void (* callback)(int32_t r, void* uparam);
   void* uparam;
 };
@@ -831,15 +1084,20 @@ static void vpe6090_read_callback(int32_t r, void* const p)
 
 exit:
   t->callback(r, t->uparam);
-  free(p);
+  slab_free(wlmio_ctx_slab(t->ctx), p);
 }
 
 
-int32_t wlmio_vpe6090_read(const uint8_t node_id, const uint8_t ch, uint16_t* const v, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+int32_t wlmio_vpe6090_read_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint8_t ch, uint16_t* const v, void (* const callback)(int32_t r, void* uparam), void* const uparam)
 {
   if(node_id > CANARD_NODE_ID_MAX || ch > 5 || v == NULL || callback == NULL) { return -EINVAL; }
 
-  struct vpe6090_read* t = malloc(sizeof(struct vpe6090_read));
+  struct vpe6090_read* t;
+  int32_t r = slab_alloc(wlmio_ctx_slab(ctx), sizeof(struct vpe6090_read), (void**)&t);
+  if(r < 0)
+  { return r; }
+
+  t->ctx = ctx;
   t->input = v;
   t->callback = callback;
   t->uparam = uparam;
@@ -871,10 +1129,10 @@ int32_t wlmio_vpe6090_read(const uint8_t node_id, const uint8_t ch, uint16_t* co
       name = "ch6.input";
       break;
   }
-	int32_t r = wlmio_register_access(node_id, name, NULL, &t->reg, &vpe6090_read_callback, t);
+	r = wlmio_register_access_ctx(ctx, node_id, name, NULL, &t->reg, &vpe6090_read_callback, t);
   if(r < 0)
   {
-    free(t);
+    slab_free(wlmio_ctx_slab(ctx), t);
     goto exit;
   }
 
@@ -885,7 +1143,25 @@ exit:
 }
 
 
-int32_t wlmio_vpe6090_configure(const uint8_t node_id, const uint8_t ch, uint8_t type, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+int32_t wlmio_vpe6090_read(const uint8_t node_id, const uint8_t ch, uint16_t* const v, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	return wlmio_vpe6090_read_ctx(wlmio_default_ctx(), node_id, ch, v, callback, uparam);
+}
+
+
+int32_t wlmio_vpe6090_read_all_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, uint16_t* const v, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+  return input_read_all(ctx, node_id, 6, v, callback, uparam);
+}
+
+
+int32_t wlmio_vpe6090_read_all(const uint8_t node_id, uint16_t* const v, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	return wlmio_vpe6090_read_all_ctx(wlmio_default_ctx(), node_id, v, callback, uparam);
+}
+
+
+int32_t wlmio_vpe6090_configure_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint8_t ch, uint8_t type, void (* const callback)(int32_t r, void* uparam), void* const uparam)
 {
   if(node_id > CANARD_NODE_ID_MAX || ch > 5 || callback == NULL || type > WLMIO_VPE6090_TYPE_T)
   { return -EINVAL; }
@@ -925,16 +1201,23 @@ int32_t wlmio_vpe6090_configure(const uint8_t node_id, const uint8_t ch, uint8_t
 
   memcpy(regw.value, &type, 1);
 
-	int32_t r = wlmio_register_access(node_id, name, &regw, NULL, callback, uparam);
+	int32_t r = wlmio_register_access_ctx(ctx, node_id, name, &regw, NULL, callback, uparam);
 
 	return r;
 }
 
 
+int32_t wlmio_vpe6090_configure(const uint8_t node_id, const uint8_t ch, uint8_t type, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	return wlmio_vpe6090_configure_ctx(wlmio_default_ctx(), node_id, ch, type, callback, uparam);
+}
+
+
 struct vpe6180_read
 {
   struct wlmio_register_access reg;
   uint16_t* input;
+  struct wlmio_ctx* ctx;
   void (* callback)(int32_t r, void* uparam);
   void* uparam;
 };
@@ -959,16 +1242,21 @@ static void vpe6180_read_callback(int32_t r, void* const p)
 
 exit:
   t->callback(r, t->uparam);
-  free(p);
+  slab_free(wlmio_ctx_slab(t->ctx), p);
 }
 
 
-int32_t wlmio_vpe6180_read(const uint8_t node_id, const uint8_t ch, uint16_t* const v, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+int32_t wlmio_vpe6180_read_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint8_t ch, uint16_t* const v, void (* const callback)(int32_t r, void* uparam), void* const uparam)
 {
   if (node_id > CANARD_NODE_ID_MAX || ch > 7 || v == NULL || callback == NULL)
     return -EINVAL;
 
-  struct vpe6180_read* t = malloc(sizeof(struct vpe6180_read));
+  struct vpe6180_read* t;
+  int32_t r = slab_alloc(wlmio_ctx_slab(ctx), sizeof(struct vpe6180_read), (void**)&t);
+  if(r < 0)
+  { return r; }
+
+  t->ctx = ctx;
   t->input = v;
   t->callback = callback;
   t->uparam = uparam;
@@ -1007,10 +1295,10 @@ int32_t wlmio_vpe6180_read(const uint8_t node_id, const uint8_t ch, uint16_t* co
       name = "ch8.input";
       break;
   }
-	int32_t r = wlmio_register_access(node_id, name, NULL, &t->reg, &vpe6180_read_callback, t);
+	r = wlmio_register_access_ctx(ctx, node_id, name, NULL, &t->reg, &vpe6180_read_callback, t);
   if(r < 0)
   {
-    free(t);
+    slab_free(wlmio_ctx_slab(ctx), t);
     goto exit;
   }
 
@@ -1021,7 +1309,25 @@ exit:
 }
 
 
-int32_t wlmio_vpe6190_configure(const uint8_t node_id, const uint8_t ch, uint8_t enable, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+int32_t wlmio_vpe6180_read(const uint8_t node_id, const uint8_t ch, uint16_t* const v, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	return wlmio_vpe6180_read_ctx(wlmio_default_ctx(), node_id, ch, v, callback, uparam);
+}
+
+
+int32_t wlmio_vpe6180_read_all_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, uint16_t* const v, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+  return input_read_all(ctx, node_id, 8, v, callback, uparam);
+}
+
+
+int32_t wlmio_vpe6180_read_all(const uint8_t node_id, uint16_t* const v, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	return wlmio_vpe6180_read_all_ctx(wlmio_default_ctx(), node_id, v, callback, uparam);
+}
+
+
+int32_t wlmio_vpe6190_configure_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint8_t ch, uint8_t enable, void (* const callback)(int32_t r, void* uparam), void* const uparam)
 {
   if (node_id > CANARD_NODE_ID_MAX || ch > 3 || callback == NULL)
     return -EINVAL;
@@ -1050,16 +1356,23 @@ int32_t wlmio_vpe6190_configure(const uint8_t node_id, const uint8_t ch, uint8_t
 
   memcpy(regw.value, &enable, 1);
 
-	int32_t r = wlmio_register_access(node_id, name, &regw, NULL, callback, uparam);
+	int32_t r = wlmio_register_access_ctx(ctx, node_id, name, &regw, NULL, callback, uparam);
 
 	return r;
 }
 
 
+int32_t wlmio_vpe6190_configure(const uint8_t node_id, const uint8_t ch, uint8_t enable, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	return wlmio_vpe6190_configure_ctx(wlmio_default_ctx(), node_id, ch, enable, callback, uparam);
+}
+
+
 struct vpe6190_read
 {
   struct wlmio_register_access reg;
   uint32_t* input;
+  struct wlmio_ctx* ctx;
   void (* callback)(int32_t r, void* uparam);
   void* uparam;
 };
@@ -1083,16 +1396,21 @@ static void vpe6190_read_callback(int32_t r, void* const p)
 
 exit:
   t->callback(r, t->uparam);
-  free(p);
+  slab_free(wlmio_ctx_slab(t->ctx), p);
 }
 
 
-int32_t wlmio_vpe6190_read(const uint8_t node_id, const uint8_t ch, uint32_t* const v, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+int32_t wlmio_vpe6190_read_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint8_t ch, uint32_t* const v, void (* const callback)(int32_t r, void* uparam), void* const uparam)
 {
   if (node_id > CANARD_NODE_ID_MAX || ch > 3 || v == NULL || callback == NULL)
     return -EINVAL;
 
-  struct vpe6190_read* t = malloc(sizeof(struct vpe6190_read));
+  struct vpe6190_read* t;
+  int32_t r = slab_alloc(wlmio_ctx_slab(ctx), sizeof(struct vpe6190_read), (void**)&t);
+  if(r < 0)
+  { return r; }
+
+  t->ctx = ctx;
   t->input = v;
   t->callback = callback;
   t->uparam = uparam;
@@ -1111,10 +1429,10 @@ int32_t wlmio_vpe6190_read(const uint8_t node_id, const uint8_t ch, uint32_t* co
       name = "ch3.input";
       break;
   }
-	int32_t r = wlmio_register_access(node_id, name, NULL, &t->reg, &vpe6190_read_callback, t);
+	r = wlmio_register_access_ctx(ctx, node_id, name, NULL, &t->reg, &vpe6190_read_callback, t);
   if(r < 0)
   {
-    free(t);
+    slab_free(wlmio_ctx_slab(ctx), t);
     goto exit;
   }
 
@@ -1122,4 +1440,10 @@ int32_t wlmio_vpe6190_read(const uint8_t node_id, const uint8_t ch, uint32_t* co
 
 exit:
 	return r;
+}
+
+
+int32_t wlmio_vpe6190_read(const uint8_t node_id, const uint8_t ch, uint32_t* const v, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	return wlmio_vpe6190_read_ctx(wlmio_default_ctx(), node_id, ch, v, callback, uparam);
 }
\ No newline at end of file
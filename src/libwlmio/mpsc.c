@@ -0,0 +1,106 @@
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mpsc.h"
+
+
+#define MPSC_ALIGNMENT 64U
+
+struct mpsc_cell
+{
+	atomic_size_t sequence;
+	alignas(max_align_t) uint8_t data[];
+};
+
+
+static struct mpsc_cell* mpsc_cell(const struct mpsc* const q, const size_t position)
+{
+	return (struct mpsc_cell*)(q->cells + (position & q->mask) * q->stride);
+}
+
+
+int mpsc_init(struct mpsc* const q, const size_t capacity, const size_t element_size)
+{
+	size_t n = 1;
+	while(n < capacity)
+	{ n <<= 1; }
+
+	const size_t align = alignof(struct mpsc_cell);
+	q->stride = (sizeof(struct mpsc_cell) + element_size + align - 1) / align * align;
+	q->element_size = element_size;
+	q->mask = n - 1;
+
+	const size_t length = (n * q->stride + MPSC_ALIGNMENT - 1) / MPSC_ALIGNMENT * MPSC_ALIGNMENT;
+	q->cells = aligned_alloc(MPSC_ALIGNMENT, length);
+	if(!q->cells)
+	{ return -ENOMEM; }
+
+	// a cell is free for the producer whose position equals its sequence
+	for(size_t i = 0; i < n; i += 1)
+	{ atomic_init(&mpsc_cell(q, i)->sequence, i); }
+
+	atomic_init(&q->head, 0);
+	q->tail = 0;
+
+	return 0;
+}
+
+
+void mpsc_deinit(struct mpsc* const q)
+{
+	free(q->cells);
+	q->cells = NULL;
+}
+
+
+int32_t mpsc_push(struct mpsc* const q, const void* const element)
+{
+	size_t position = atomic_load_explicit(&q->head, memory_order_relaxed);
+	struct mpsc_cell* cell;
+
+	while(1)
+	{
+		cell = mpsc_cell(q, position);
+		const size_t sequence = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+		const intptr_t d = (intptr_t)sequence - (intptr_t)position;
+
+		if(d == 0)
+		{
+			if(atomic_compare_exchange_weak_explicit(&q->head, &position, position + 1, memory_order_relaxed, memory_order_relaxed))
+			{ break; }
+		}
+		// the consumer has not released this cell from the previous lap yet
+		else if(d < 0)
+		{ return -EAGAIN; }
+		else
+		{ position = atomic_load_explicit(&q->head, memory_order_relaxed); }
+	}
+
+	memcpy(cell->data, element, q->element_size);
+	atomic_store_explicit(&cell->sequence, position + 1, memory_order_release);
+
+	return 0;
+}
+
+
+int32_t mpsc_pop(struct mpsc* const q, void* const element)
+{
+	struct mpsc_cell* const cell = mpsc_cell(q, q->tail);
+	const size_t sequence = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+
+	// empty, or the producer that claimed the cell is still copying its element in
+	if(sequence != q->tail + 1)
+	{ return -EAGAIN; }
+
+	memcpy(element, cell->data, q->element_size);
+	atomic_store_explicit(&cell->sequence, q->tail + q->mask + 1, memory_order_release);
+	q->tail += 1;
+
+	return 0;
+}
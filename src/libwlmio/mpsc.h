@@ -0,0 +1,43 @@
+#pragma once
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+// Bounded lock-free queue with any number of producers and a single consumer. Every cell carries
+// a sequence number that tells producers whether the cell is free for the lap they are on and
+// tells the consumer whether the element in it has been published, so producers only contend on
+// the head index and never wait on each other. Elements are copied in and out by value.
+
+struct mpsc
+{
+	uint8_t* cells;
+	size_t stride;
+	size_t element_size;
+	size_t mask;
+
+	_Alignas(64) atomic_size_t head;
+	_Alignas(64) size_t tail;
+};
+
+/**
+ * @param capacity Number of elements, rounded up to a power of two
+ * @return Returns 0 if success else -ENOMEM
+*/
+int mpsc_init(struct mpsc* q, size_t capacity, size_t element_size);
+void mpsc_deinit(struct mpsc* q);
+
+/**
+ * May be called from any thread.
+ *
+ * @return Returns 0 if success else -EAGAIN if the queue is full
+*/
+int32_t mpsc_push(struct mpsc* q, const void* element);
+
+/**
+ * Must only be called from the consuming thread.
+ *
+ * @return Returns 0 if success else -EAGAIN if the queue is empty
+*/
+int32_t mpsc_pop(struct mpsc* q, void* element);
@@ -0,0 +1,149 @@
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <errno.h>
+#include <string.h>
+
+#include <sys/mman.h>
+
+#include "pool.h"
+
+
+struct pool_block
+{
+	struct pool_block* next;
+};
+
+// block sizes are chosen for what libcanard allocates on this bus:
+//   64  - RX sessions and payloads of the small extents (heartbeat, command, register list)
+//   144 - TX queue items of single-frame transfers
+//   400 - TX queue items of multi-frame transfers (up to the 310 byte register access request
+//         with CRC and padding), reassembled register access (267) and node info (313) payloads
+// the arena is shared out between the classes in proportion to their weights
+static const size_t class_block_size[POOL_CLASS_COUNT] = { 64, 144, 400 };
+static const size_t class_weight[POOL_CLASS_COUNT] = { 1, 2, 1 };
+
+
+int pool_init(struct pool* const pool, const size_t arena_size, const bool lock_memory)
+{
+	if(pool->arena)
+	{ return -EBUSY; }
+
+	size_t weight_total = 0;
+	for(size_t i = 0; i < POOL_CLASS_COUNT; i += 1)
+	{ weight_total += class_weight[i]; }
+
+	uint8_t* const arena = mmap(NULL, arena_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if(arena == MAP_FAILED)
+	{ return -errno; }
+	pool->arena = arena;
+	pool->arena_length = arena_size;
+
+	if(lock_memory && mlock(arena, arena_size) < 0)
+	{
+		const int r = -errno;
+		pool_deinit(pool);
+		return r;
+	}
+
+	uint8_t* p = arena;
+	for(size_t i = 0; i < POOL_CLASS_COUNT; i += 1)
+	{
+		struct pool_class* const c = &pool->classes[i];
+		*c = (struct pool_class)
+		{
+			.block_size = class_block_size[i],
+			.blocks = (arena_size / weight_total * class_weight[i]) / class_block_size[i]
+		};
+
+		c->begin = p;
+		c->end = p + c->blocks * c->block_size;
+		p = c->end;
+
+		// thread the free list through the blocks, this also faults every page in up front
+		for(size_t j = c->blocks; j > 0; j -= 1)
+		{
+			struct pool_block* const block = (struct pool_block*)(c->begin + (j - 1) * c->block_size);
+			block->next = c->free_list;
+			c->free_list = block;
+		}
+	}
+
+	return 0;
+}
+
+
+void pool_deinit(struct pool* const pool)
+{
+	if(pool->arena)
+	{ munmap(pool->arena, pool->arena_length); }
+
+	*pool = (struct pool) { .arena = NULL };
+}
+
+
+void* pool_alloc(struct pool* const pool, const size_t amount)
+{
+	for(size_t i = 0; i < POOL_CLASS_COUNT; i += 1)
+	{
+		struct pool_class* const c = &pool->classes[i];
+		if(amount > c->block_size)
+		{ continue; }
+
+		struct pool_block* const block = c->free_list;
+		if(!block)
+		{
+			c->failures += 1;
+			continue;
+		}
+
+		c->free_list = block->next;
+		c->used += 1;
+		if(c->used > c->high_water)
+		{ c->high_water = c->used; }
+
+		return block;
+	}
+
+	return NULL;
+}
+
+
+void pool_free(struct pool* const pool, void* const pointer)
+{
+	if(!pointer)
+	{ return; }
+
+	for(size_t i = 0; i < POOL_CLASS_COUNT; i += 1)
+	{
+		struct pool_class* const c = &pool->classes[i];
+		if((uint8_t*)pointer < c->begin || (uint8_t*)pointer >= c->end)
+		{ continue; }
+
+		struct pool_block* const block = pointer;
+		block->next = c->free_list;
+		c->free_list = block;
+		c->used -= 1;
+		return;
+	}
+}
+
+
+size_t pool_get_stats(const struct pool* const pool, struct wlmio_pool_stats* const stats, const size_t count)
+{
+	const size_t n = count < POOL_CLASS_COUNT ? count : POOL_CLASS_COUNT;
+	for(size_t i = 0; i < n; i += 1)
+	{
+		stats[i] = (struct wlmio_pool_stats)
+		{
+			.block_size = pool->classes[i].block_size,
+			.blocks = pool->classes[i].blocks,
+			.used = pool->classes[i].used,
+			.high_water = pool->classes[i].high_water,
+			.failures = pool->classes[i].failures
+		};
+	}
+
+	return POOL_CLASS_COUNT;
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "wlmio.h"
+
+
+// Fixed size block allocator used as the libcanard memory manager. The arena is split into a
+// handful of size classes, each class is a free list of equally sized blocks so allocation and
+// release are O(1) and the heap never fragments. A request that does not fit its own class
+// spills into the next larger one.
+
+#define POOL_CLASS_COUNT 3
+
+struct pool_block;
+
+struct pool_class
+{
+	size_t block_size;
+	uint8_t* begin;
+	uint8_t* end;
+	struct pool_block* free_list;
+	size_t blocks;
+	size_t used;
+	size_t high_water;
+	size_t failures;
+};
+
+struct pool
+{
+	uint8_t* arena;
+	size_t arena_length;
+	struct pool_class classes[POOL_CLASS_COUNT];
+};
+
+int pool_init(struct pool* pool, size_t arena_size, bool lock_memory);
+void pool_deinit(struct pool* pool);
+
+void* pool_alloc(struct pool* pool, size_t amount);
+void pool_free(struct pool* pool, void* pointer);
+
+size_t pool_get_stats(const struct pool* pool, struct wlmio_pool_stats* stats, size_t count);
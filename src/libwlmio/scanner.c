@@ -0,0 +1,349 @@
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <canard.h>
+
+#include "context.h"
+#include "wlmio.h"
+
+
+// The scanner runs on the event loop thread. Each cycle it issues every due point as a register
+// access, inputs as reads and outputs as writes of the latest value in the write image, and lets
+// the per-node queues pipeline them onto the bus. Results are published into the process image
+// under a sequence lock: the loop thread makes the sequence odd while it updates an entry and even
+// again afterwards, and readers on other threads retry their copy until they see the same even
+// sequence before and after it. The write image uses a second sequence lock the other way round.
+
+struct scan_point
+{
+	struct wlmio_scanner* scanner;
+	struct wlmio_scan_point point;
+	struct wlmio_register_template request;
+	uint64_t next_due;
+	int64_t handle;
+	struct wlmio_register_access tx;
+	struct wlmio_register_access rx;
+};
+
+struct scan_output
+{
+	struct wlmio_register_access value;
+	bool valid;
+};
+
+struct wlmio_scanner
+{
+	struct wlmio_ctx* ctx;
+	struct timer_entry timer;
+	struct wlmio_request_options opts;
+	uint64_t cycle_time;
+	uint64_t next_cycle;
+	uint64_t cycle_start;
+	size_t outstanding;
+	size_t count;
+	struct scan_point* points;
+
+	alignas(64) atomic_uint image_seq;
+	struct wlmio_scan_value* image;
+	struct wlmio_scan_stats stats;
+
+	alignas(64) atomic_uint output_seq;
+	struct scan_output* outputs;
+};
+
+
+static void seq_write_begin(atomic_uint* const seq)
+{
+	const unsigned s = atomic_load_explicit(seq, memory_order_relaxed);
+	atomic_store_explicit(seq, s + 1, memory_order_relaxed);
+	atomic_thread_fence(memory_order_release);
+}
+
+
+static void seq_write_end(atomic_uint* const seq)
+{
+	const unsigned s = atomic_load_explicit(seq, memory_order_relaxed);
+	atomic_store_explicit(seq, s + 1, memory_order_release);
+}
+
+
+static unsigned seq_read_begin(const atomic_uint* const seq)
+{
+	unsigned s;
+	while((s = atomic_load_explicit(seq, memory_order_acquire)) & 1U)
+	{ }
+
+	return s;
+}
+
+
+static bool seq_read_retry(const atomic_uint* const seq, const unsigned s)
+{
+	atomic_thread_fence(memory_order_acquire);
+	return atomic_load_explicit(seq, memory_order_relaxed) != s;
+}
+
+
+// advance a deadline by whole periods until it lies after now, so a late cycle skips the periods
+// it missed instead of bursting to catch up while keeping its phase
+static uint64_t scanner_advance(uint64_t deadline, const uint64_t period, const uint64_t now)
+{
+	deadline += period;
+	if(deadline <= now)
+	{ deadline += ((now - deadline) / period + 1) * period; }
+
+	return deadline;
+}
+
+
+static void scanner_publish(struct wlmio_scanner* const s, const struct scan_point* const p, const int32_t r)
+{
+	struct wlmio_scan_value* const v = &s->image[p - s->points];
+
+	seq_write_begin(&s->image_seq);
+
+	v->status = r;
+	if(r >= 0)
+	{
+		v->value.type = p->rx.type;
+		v->value.length = p->rx.length;
+		memcpy(v->value.value, p->rx.value, sizeof(p->rx.value));
+		v->timestamp = wlmio_ctx_monotonic_usec();
+		v->quality = WLMIO_SCAN_QUALITY_GOOD;
+	}
+	else if(v->quality == WLMIO_SCAN_QUALITY_GOOD || v->quality == WLMIO_SCAN_QUALITY_STALE)
+	{ v->quality = WLMIO_SCAN_QUALITY_STALE; }
+	else
+	{ v->quality = WLMIO_SCAN_QUALITY_BAD; }
+
+	seq_write_end(&s->image_seq);
+}
+
+
+static void scanner_cycle_done(struct wlmio_scanner* const s)
+{
+	const uint64_t cycle_time = wlmio_ctx_monotonic_usec() - s->cycle_start;
+
+	seq_write_begin(&s->image_seq);
+	s->stats.cycle_time = cycle_time;
+	if(cycle_time > s->stats.cycle_time_max)
+	{ s->stats.cycle_time_max = cycle_time; }
+	seq_write_end(&s->image_seq);
+}
+
+
+static void scan_point_callback(int32_t r, void* const uparam)
+{
+	struct scan_point* const p = uparam;
+	struct wlmio_scanner* const s = p->scanner;
+
+	p->handle = -1;
+	s->outstanding -= 1;
+
+	// a node answers a nonexistent register with an empty value
+	if(r >= 0 && p->rx.type == WLMIO_REGISTER_VALUE_EMPTY)
+	{ r = -ENOENT; }
+
+	scanner_publish(s, p, r);
+
+	if(s->outstanding == 0)
+	{ scanner_cycle_done(s); }
+}
+
+
+static bool scanner_load_output(struct wlmio_scanner* const s, struct scan_point* const p)
+{
+	const struct scan_output* const o = &s->outputs[p - s->points];
+
+	bool valid;
+	unsigned seq;
+	do
+	{
+		seq = seq_read_begin(&s->output_seq);
+		valid = o->valid;
+		p->tx = o->value;
+	} while(seq_read_retry(&s->output_seq, seq));
+
+	return valid;
+}
+
+
+static void scanner_cycle(struct wlmio_ctx* const ctx, struct timer_entry* const timer)
+{
+	struct wlmio_scanner* const s = (struct wlmio_scanner*)((uint8_t*)timer - offsetof(struct wlmio_scanner, timer));
+
+	const uint64_t now = wlmio_ctx_monotonic_usec();
+	const uint64_t jitter = now - s->next_cycle;
+
+	// a cycle overruns when the previous one still has requests on the bus or when it started so
+	// late that a whole cycle was skipped
+	const uint64_t next = scanner_advance(s->next_cycle, s->cycle_time, now);
+	const bool overrun = s->outstanding > 0 || next - s->next_cycle > s->cycle_time;
+	s->next_cycle = next;
+	wlmio_ctx_timer_schedule(ctx, &s->timer, s->next_cycle);
+
+	seq_write_begin(&s->image_seq);
+	s->stats.cycles += 1;
+	s->stats.overruns += overrun;
+	s->stats.jitter = jitter;
+	if(jitter > s->stats.jitter_max)
+	{ s->stats.jitter_max = jitter; }
+	seq_write_end(&s->image_seq);
+
+	// points still outstanding from an overrun cycle are skipped rather than issued twice
+	if(s->outstanding == 0)
+	{ s->cycle_start = now; }
+
+	for(size_t i = 0; i < s->count; i += 1)
+	{
+		struct scan_point* const p = &s->points[i];
+		if(p->handle >= 0 || now < p->next_due)
+		{ continue; }
+
+		const bool output = p->point.direction == WLMIO_SCAN_OUTPUT;
+		if(output && !scanner_load_output(s, p))
+		{ continue; }
+
+		p->next_due = p->point.period ? scanner_advance(p->next_due, p->point.period, now) : 0;
+
+		const int64_t r = wlmio_register_template_access_ex_ctx(ctx, &p->request, output ? &p->tx : NULL, &p->rx, &s->opts, scan_point_callback, p);
+		if(r < 0)
+		{
+			scanner_publish(s, p, r);
+			continue;
+		}
+
+		p->handle = r;
+		s->outstanding += 1;
+	}
+
+	if(s->outstanding == 0)
+	{ scanner_cycle_done(s); }
+}
+
+
+struct wlmio_scanner* wlmio_scanner_open_ctx(struct wlmio_ctx* const ctx, const struct wlmio_scan_point* const points, const size_t count, const uint64_t cycle_time, const struct wlmio_request_options* const opts)
+{
+	if(!ctx || !points || count == 0 || cycle_time == 0 || (opts && opts->priority > WLMIO_PRIORITY_OPTIONAL))
+	{ return NULL; }
+
+	for(size_t i = 0; i < count; i += 1)
+	{
+		const struct wlmio_scan_point* const p = &points[i];
+		const size_t name_len = strnlen(p->name, sizeof(p->name));
+		if(p->node_id >= CANARD_NODE_ID_MAX || p->direction > WLMIO_SCAN_OUTPUT || name_len == 0 || name_len > 50)
+		{ return NULL; }
+	}
+
+	// the sequence counters sit on their own cache lines
+	struct wlmio_scanner* const s = aligned_alloc(alignof(struct wlmio_scanner), sizeof(struct wlmio_scanner));
+	if(!s)
+	{ return NULL; }
+
+	memset(s, 0, sizeof(struct wlmio_scanner));
+
+	s->points = calloc(count, sizeof(struct scan_point));
+	s->image = calloc(count, sizeof(struct wlmio_scan_value));
+	s->outputs = calloc(count, sizeof(struct scan_output));
+	if(!s->points || !s->image || !s->outputs)
+	{ goto fail; }
+
+	s->ctx = ctx;
+	s->count = count;
+	s->cycle_time = cycle_time;
+	s->opts = opts ? *opts : (struct wlmio_request_options){ .priority = WLMIO_PRIORITY_NOMINAL };
+	atomic_init(&s->image_seq, 0);
+	atomic_init(&s->output_seq, 0);
+
+	for(size_t i = 0; i < count; i += 1)
+	{
+		s->points[i].scanner = s;
+		s->points[i].point = points[i];
+		wlmio_register_template_init(&s->points[i].request, points[i].node_id, points[i].name);
+		s->points[i].handle = -1;
+		s->image[i].quality = WLMIO_SCAN_QUALITY_NONE;
+	}
+
+	// the first cycle runs on the next wlmio_tick()
+	wlmio_ctx_timer_init(&s->timer, scanner_cycle);
+	s->next_cycle = wlmio_ctx_monotonic_usec();
+	if(wlmio_ctx_timer_schedule(ctx, &s->timer, s->next_cycle) < 0)
+	{ goto fail; }
+
+	return s;
+
+fail:
+	free(s->outputs);
+	free(s->image);
+	free(s->points);
+	free(s);
+	return NULL;
+}
+
+
+struct wlmio_scanner* wlmio_scanner_open(const struct wlmio_scan_point* const points, const size_t count, const uint64_t cycle_time, const struct wlmio_request_options* const opts)
+{
+	return wlmio_scanner_open_ctx(wlmio_default_ctx(), points, count, cycle_time, opts);
+}
+
+
+void wlmio_scanner_close(struct wlmio_scanner* const s)
+{
+	if(!s)
+	{ return; }
+
+	wlmio_ctx_timer_cancel(s->ctx, &s->timer);
+
+	for(size_t i = 0; i < s->count; i += 1)
+	{
+		if(s->points[i].handle >= 0)
+		{ wlmio_cancel_ctx(s->ctx, s->points[i].handle); }
+	}
+
+	free(s->outputs);
+	free(s->image);
+	free(s->points);
+	free(s);
+}
+
+
+int32_t wlmio_scanner_write(struct wlmio_scanner* const s, const size_t index, const struct wlmio_register_access* const value)
+{
+	if(!s || !value || index >= s->count || s->points[index].point.direction != WLMIO_SCAN_OUTPUT || value->type > WLMIO_REGISTER_VALUE_FLOAT16)
+	{ return -EINVAL; }
+
+	struct scan_output* const o = &s->outputs[index];
+
+	seq_write_begin(&s->output_seq);
+	o->value = *value;
+	o->valid = true;
+	seq_write_end(&s->output_seq);
+
+	return 0;
+}
+
+
+int32_t wlmio_scanner_read(const struct wlmio_scanner* const s, struct wlmio_scan_value* const image, const size_t count, struct wlmio_scan_stats* const stats)
+{
+	if(!s || (count > 0 && !image) || count > s->count)
+	{ return -EINVAL; }
+
+	unsigned seq;
+	do
+	{
+		seq = seq_read_begin(&s->image_seq);
+		if(count > 0)
+		{ memcpy(image, s->image, count * sizeof(struct wlmio_scan_value)); }
+		if(stats)
+		{ *stats = s->stats; }
+	} while(seq_read_retry(&s->image_seq, seq));
+
+	return 0;
+}
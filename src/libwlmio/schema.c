@@ -0,0 +1,488 @@
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "context.h"
+#include "schema.h"
+#include "wlmio.h"
+
+
+#ifndef WLMIO_SCHEMA_CACHE_DIR
+#define WLMIO_SCHEMA_CACHE_DIR "/var/cache/wlmio"
+#endif
+
+// number of times a query starts over when the node restarts or goes offline under it
+#ifndef WLMIO_SCHEMA_QUERY_RETRIES
+#define WLMIO_SCHEMA_QUERY_RETRIES 3
+#endif
+
+// empty when schemas are not persisted
+static char schema_dir[PATH_MAX] = WLMIO_SCHEMA_CACHE_DIR;
+
+
+// A query first serves the node's current entry, deferred to the next tick through a timer so the
+// callback never runs from inside the call. Without an entry it fetches the node info and tries the
+// schema file for that unique ID and revision, and only enumerates the registers if there is none.
+// Queries are listed in the cache so the ones still running when the context closes are freed. A
+// query that loses a race with a node restart starts over instead of failing with -EAGAIN.
+struct schema_query
+{
+	struct wlmio_ctx* ctx;
+	struct schema_query* next;
+	struct timer_entry timer;
+	uint8_t node_id;
+	uint32_t generation;
+	uint8_t retries;
+	uint16_t index;
+	struct wlmio_node_info info;
+	char name[51];
+	struct wlmio_register_access reg;
+	struct schema_header* build;
+	size_t build_capacity;
+	int32_t r;
+	struct wlmio_register_schema* schema;
+	size_t capacity;
+	void (* callback)(int32_t r, void* uparam);
+	void* uparam;
+};
+
+
+static void schema_entry_release(struct schema_entry* const entry)
+{
+	if(!entry->header)
+	{ return; }
+
+	if(entry->mapped)
+	{ munmap(entry->header, entry->length); }
+	else
+	{ free(entry->header); }
+
+	entry->header = NULL;
+	entry->length = 0;
+	entry->mapped = false;
+}
+
+
+// queries still running are dropped without a callback, like the requests they wait for
+void schema_cache_deinit(struct schema_cache* const cache)
+{
+	struct schema_query* q = cache->queries;
+	while(q)
+	{
+		struct schema_query* const next = q->next;
+		free(q->build);
+		free(q);
+		q = next;
+	}
+	cache->queries = NULL;
+
+	for(size_t i = 0; i <= CANARD_NODE_ID_MAX; i += 1)
+	{ schema_entry_release(&cache->nodes[i]); }
+}
+
+
+void schema_cache_invalidate(struct schema_cache* const cache, const uint8_t node_id)
+{
+	schema_entry_release(&cache->nodes[node_id]);
+	cache->nodes[node_id].generation += 1;
+}
+
+
+static bool schema_header_valid(const struct schema_header* const header, const size_t length, const struct wlmio_node_info* const info)
+{
+	if(
+		length < sizeof(struct schema_header)
+		|| header->magic != SCHEMA_MAGIC
+		|| header->version != SCHEMA_VERSION
+		|| header->record_size != sizeof(struct wlmio_register_schema)
+		|| header->count > (length - sizeof(struct schema_header)) / sizeof(struct wlmio_register_schema)
+		|| memcmp(header->unique_id, info->unique_id, sizeof(header->unique_id)) != 0
+		|| header->software_vcs_revision_id != info->software_vcs_revision_id
+	)
+	{ return false; }
+
+	// names are handed to callers as strings
+	for(size_t i = 0; i < header->count; i += 1)
+	{
+		if(!memchr(header->records[i].name, '\0', sizeof(header->records[i].name)))
+		{ return false; }
+	}
+
+	return true;
+}
+
+
+static int schema_path(char* const path, const size_t size, const struct wlmio_node_info* const info)
+{
+	char uid[33];
+	for(size_t i = 0; i < 16; i += 1)
+	{ snprintf(uid + 2 * i, 3, "%02x", info->unique_id[i]); }
+
+	const int n = snprintf(path, size, "%s/%s-%016llx.schema", schema_dir, uid, (unsigned long long)info->software_vcs_revision_id);
+	return n > 0 && (size_t)n < size ? 0 : -ENAMETOOLONG;
+}
+
+
+static int32_t schema_map(struct schema_entry* const entry, const struct wlmio_node_info* const info)
+{
+	char path[PATH_MAX];
+	if(schema_dir[0] == '\0' || schema_path(path, sizeof(path), info) < 0)
+	{ return -ENOENT; }
+
+	const int fd = open(path, O_RDONLY | O_CLOEXEC);
+	if(fd < 0)
+	{ return -errno; }
+
+	int32_t r;
+	struct stat st;
+	if(fstat(fd, &st) < 0)
+	{
+		r = -errno;
+		goto exit;
+	}
+
+	void* const base = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	if(base == MAP_FAILED)
+	{
+		r = -errno;
+		goto exit;
+	}
+
+	// a file of another layout or identity is ignored and rewritten after enumeration
+	if(!schema_header_valid(base, st.st_size, info))
+	{
+		munmap(base, st.st_size);
+		r = -ENOENT;
+		goto exit;
+	}
+
+	entry->header = base;
+	entry->length = st.st_size;
+	entry->mapped = true;
+	r = 0;
+
+exit:
+	close(fd);
+	return r;
+}
+
+
+// written to a temporary file that is renamed into place, so a concurrent reader never maps a
+// partial schema
+static int32_t schema_store(const struct schema_header* const header, const size_t length, const struct wlmio_node_info* const info)
+{
+	char path[PATH_MAX];
+	char tmp[PATH_MAX];
+	if(schema_dir[0] == '\0' || schema_path(path, sizeof(path), info) < 0)
+	{ return -ENOENT; }
+
+	const int n = snprintf(tmp, sizeof(tmp), "%s.%ld.tmp", path, (long)getpid());
+	if(n < 0 || (size_t)n >= sizeof(tmp))
+	{ return -ENAMETOOLONG; }
+
+	if(mkdir(schema_dir, 0755) < 0 && errno != EEXIST)
+	{ return -errno; }
+
+	const int fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+	if(fd < 0)
+	{ return -errno; }
+
+	const ssize_t w = write(fd, header, length);
+	close(fd);
+
+	if(w < 0 || (size_t)w != length || rename(tmp, path) < 0)
+	{
+		unlink(tmp);
+		return -EIO;
+	}
+
+	return 0;
+}
+
+
+static int32_t schema_query_start(struct schema_query* q);
+
+
+static void schema_query_finish(struct schema_query* const q)
+{
+	struct schema_cache* const cache = wlmio_ctx_schema_cache(q->ctx);
+	const struct schema_entry* const entry = &cache->nodes[q->node_id];
+	int32_t r = q->r;
+
+	if(r >= 0 && entry->header)
+	{
+		const size_t count = entry->header->count;
+		const size_t n = count < q->capacity ? count : q->capacity;
+		if(n > 0)
+		{ memcpy(q->schema, entry->header->records, n * sizeof(struct wlmio_register_schema)); }
+
+		r = count;
+	}
+	else if(r >= 0)
+	{ r = -EAGAIN; }
+
+	if(r == -EAGAIN && q->retries < WLMIO_SCHEMA_QUERY_RETRIES)
+	{
+		q->retries += 1;
+		q->r = 0;
+		free(q->build);
+		q->build = NULL;
+
+		r = schema_query_start(q);
+		if(r == 0)
+		{ return; }
+	}
+
+	struct schema_query** l = &cache->queries;
+	while(*l != q)
+	{ l = &(*l)->next; }
+	*l = q->next;
+
+	q->callback(r, q->uparam);
+
+	free(q->build);
+	free(q);
+}
+
+
+static void schema_query_deferred(struct wlmio_ctx* const ctx, struct timer_entry* const timer)
+{
+	struct schema_query* const q = (struct schema_query*)((uint8_t*)timer - offsetof(struct schema_query, timer));
+	schema_query_finish(q);
+}
+
+
+// The enumerated schema is persisted and mapped from its file, or kept as it is if that fails. It
+// is thrown away if the node restarted or went offline during the enumeration, as it may describe
+// the node as it was before.
+static void schema_query_install(struct schema_query* const q)
+{
+	struct schema_entry* const entry = &wlmio_ctx_schema_cache(q->ctx)->nodes[q->node_id];
+	const size_t length = sizeof(struct schema_header) + q->build->count * sizeof(struct wlmio_register_schema);
+
+	if(entry->generation != q->generation)
+	{ return; }
+
+	schema_entry_release(entry);
+
+	if(schema_store(q->build, length, &q->info) == 0 && schema_map(entry, &q->info) == 0)
+	{ return; }
+
+	entry->header = q->build;
+	entry->length = length;
+	entry->mapped = false;
+	q->build = NULL;
+}
+
+
+static void schema_list_callback(int32_t r, void* uparam);
+
+
+static void schema_access_callback(int32_t r, void* const uparam)
+{
+	struct schema_query* const q = uparam;
+
+	if(r < 0)
+	{ goto fail; }
+
+	struct schema_header* h = q->build;
+	if(h->count == q->build_capacity)
+	{
+		const size_t capacity = q->build_capacity * 2;
+		h = realloc(h, sizeof(struct schema_header) + capacity * sizeof(struct wlmio_register_schema));
+		if(!h)
+		{
+			r = -ENOMEM;
+			goto fail;
+		}
+
+		q->build = h;
+		q->build_capacity = capacity;
+	}
+
+	struct wlmio_register_schema* const record = &h->records[h->count];
+	memset(record, 0, sizeof(struct wlmio_register_schema));
+	memcpy(record->name, q->name, sizeof(record->name));
+	record->type = q->reg.type;
+	record->length = q->reg.length;
+	h->count += 1;
+
+	if(q->index == UINT16_MAX)
+	{
+		schema_query_install(q);
+		schema_query_finish(q);
+		return;
+	}
+
+	q->index += 1;
+	r = wlmio_register_list_ctx(q->ctx, q->node_id, q->index, q->name, schema_list_callback, q);
+	if(r < 0)
+	{ goto fail; }
+
+	return;
+
+fail:
+	q->r = r;
+	schema_query_finish(q);
+}
+
+
+static void schema_list_callback(int32_t r, void* const uparam)
+{
+	struct schema_query* const q = uparam;
+
+	if(r < 0)
+	{ goto fail; }
+
+	// an empty name follows the last register
+	if(q->name[0] == '\0')
+	{
+		schema_query_install(q);
+		schema_query_finish(q);
+		return;
+	}
+
+	r = wlmio_register_access_ctx(q->ctx, q->node_id, q->name, NULL, &q->reg, schema_access_callback, q);
+	if(r < 0)
+	{ goto fail; }
+
+	return;
+
+fail:
+	q->r = r;
+	schema_query_finish(q);
+}
+
+
+static void schema_info_callback(int32_t r, void* const uparam)
+{
+	struct schema_query* const q = uparam;
+	struct schema_entry* const entry = &wlmio_ctx_schema_cache(q->ctx)->nodes[q->node_id];
+
+	if(r < 0)
+	{ goto fail; }
+
+	// the node info may be from before a restart
+	if(entry->generation != q->generation)
+	{
+		r = -EAGAIN;
+		goto fail;
+	}
+
+	schema_entry_release(entry);
+	if(schema_map(entry, &q->info) == 0)
+	{
+		schema_query_finish(q);
+		return;
+	}
+
+	q->build_capacity = 32;
+	q->build = malloc(sizeof(struct schema_header) + q->build_capacity * sizeof(struct wlmio_register_schema));
+	if(!q->build)
+	{
+		r = -ENOMEM;
+		goto fail;
+	}
+
+	*q->build = (struct schema_header)
+	{
+		.magic = SCHEMA_MAGIC,
+		.version = SCHEMA_VERSION,
+		.software_vcs_revision_id = q->info.software_vcs_revision_id,
+		.count = 0,
+		.record_size = sizeof(struct wlmio_register_schema)
+	};
+	memcpy(q->build->unique_id, q->info.unique_id, sizeof(q->build->unique_id));
+
+	q->index = 0;
+	r = wlmio_register_list_ctx(q->ctx, q->node_id, q->index, q->name, schema_list_callback, q);
+	if(r < 0)
+	{ goto fail; }
+
+	return;
+
+fail:
+	q->r = r;
+	schema_query_finish(q);
+}
+
+
+// serve the node's entry if it has one, otherwise look the node up
+static int32_t schema_query_start(struct schema_query* const q)
+{
+	const struct schema_entry* const entry = &wlmio_ctx_schema_cache(q->ctx)->nodes[q->node_id];
+	q->generation = entry->generation;
+
+	if(entry->header)
+	{
+		wlmio_ctx_timer_init(&q->timer, schema_query_deferred);
+		return wlmio_ctx_timer_schedule(q->ctx, &q->timer, wlmio_ctx_monotonic_usec());
+	}
+
+	return wlmio_get_node_info_ctx(q->ctx, q->node_id, &q->info, schema_info_callback, q);
+}
+
+
+int32_t wlmio_get_register_schema_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, struct wlmio_register_schema* const schema, const size_t capacity, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	if(ctx == NULL || node_id >= CANARD_NODE_ID_MAX || (schema == NULL && capacity > 0) || callback == NULL)
+	{ return -EINVAL; }
+
+	struct schema_query* const q = calloc(1, sizeof(struct schema_query));
+	if(!q)
+	{ return -ENOMEM; }
+
+	struct schema_cache* const cache = wlmio_ctx_schema_cache(ctx);
+
+	q->ctx = ctx;
+	q->node_id = node_id;
+	q->schema = schema;
+	q->capacity = capacity;
+	q->callback = callback;
+	q->uparam = uparam;
+
+	const int32_t r = schema_query_start(q);
+	if(r < 0)
+	{
+		free(q);
+		return r;
+	}
+
+	q->next = cache->queries;
+	cache->queries = q;
+
+	return r;
+}
+
+
+int32_t wlmio_get_register_schema(const uint8_t node_id, struct wlmio_register_schema* const schema, const size_t capacity, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	return wlmio_get_register_schema_ctx(wlmio_default_ctx(), node_id, schema, capacity, callback, uparam);
+}
+
+
+int32_t wlmio_set_schema_cache_dir(const char* const dir)
+{
+	if(dir == NULL)
+	{
+		schema_dir[0] = '\0';
+		return 0;
+	}
+
+	if(strlen(dir) >= sizeof(schema_dir))
+	{ return -ENAMETOOLONG; }
+
+	strcpy(schema_dir, dir);
+	return 0;
+}
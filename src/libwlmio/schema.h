@@ -0,0 +1,53 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <canard.h>
+
+#include "wlmio.h"
+
+
+// Register schemas of nodes, keyed by unique ID and firmware revision. A schema is stored in a
+// file under the cache directory and memory mapped from there, or kept on the heap when it could
+// not be written. The per-node entry only says which schema belongs to the node currently at that
+// node ID, it is dropped whenever the node restarts or goes offline and looked up again by node
+// info on the next query.
+
+#define SCHEMA_MAGIC 0x43534C57U
+#define SCHEMA_VERSION 1U
+
+struct schema_header
+{
+	uint32_t magic;
+	uint32_t version;
+	uint8_t unique_id[16];
+	uint64_t software_vcs_revision_id;
+	uint32_t count;
+	uint32_t record_size;
+	struct wlmio_register_schema records[];
+};
+
+struct schema_entry
+{
+	struct schema_header* header;
+	size_t length;
+	bool mapped;
+
+	// moves on whenever the entry is invalidated, so a query can tell the node restarted under it
+	uint32_t generation;
+};
+
+struct schema_query;
+
+struct schema_cache
+{
+	struct schema_entry nodes[CANARD_NODE_ID_MAX + 1U];
+
+	// queries still waiting for the node
+	struct schema_query* queries;
+};
+
+void schema_cache_deinit(struct schema_cache* cache);
+void schema_cache_invalidate(struct schema_cache* cache, uint8_t node_id);
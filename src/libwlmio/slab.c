@@ -0,0 +1,93 @@
+#include <stddef.h>
+#include <stdint.h>
+
+#include <errno.h>
+#include <stdlib.h>
+
+#include "slab.h"
+
+
+#define SLAB_ALIGNMENT 64U
+
+struct slab_object
+{
+	struct slab_object* next;
+};
+
+
+int slab_init(struct slab* const slab, const size_t capacity, size_t object_size)
+{
+	if(slab->base)
+	{ return -EBUSY; }
+
+	object_size = (object_size + SLAB_ALIGNMENT - 1) / SLAB_ALIGNMENT * SLAB_ALIGNMENT;
+	if(object_size == 0 || capacity > SIZE_MAX / object_size)
+	{ return -EINVAL; }
+
+	slab->base = aligned_alloc(SLAB_ALIGNMENT, capacity * object_size);
+	if(!slab->base)
+	{ return -ENOMEM; }
+
+	slab->capacity = capacity;
+	slab->object_size = object_size;
+	slab->free_list = NULL;
+	for(size_t i = capacity; i > 0; i -= 1)
+	{
+		struct slab_object* const object = (struct slab_object*)(slab->base + (i - 1) * object_size);
+		object->next = slab->free_list;
+		slab->free_list = object;
+	}
+
+	return 0;
+}
+
+
+void slab_deinit(struct slab* const slab)
+{
+	free(slab->base);
+	slab->base = NULL;
+	slab->capacity = 0;
+	slab->object_size = 0;
+	slab->free_list = NULL;
+}
+
+
+int32_t slab_alloc(struct slab* const slab, const size_t size, void** const object)
+{
+	if(!slab->base || size > slab->object_size)
+	{ return -ENOMEM; }
+
+	if(!slab->free_list)
+	{ return -EBUSY; }
+
+	*object = slab->free_list;
+	slab->free_list = slab->free_list->next;
+
+	return 0;
+}
+
+
+void slab_free(struct slab* const slab, void* const object)
+{
+	if(!object)
+	{ return; }
+
+	struct slab_object* const o = object;
+	o->next = slab->free_list;
+	slab->free_list = o;
+}
+
+
+size_t slab_index(const struct slab* const slab, const void* const object)
+{
+	return ((const uint8_t*)object - slab->base) / slab->object_size;
+}
+
+
+void* slab_object(const struct slab* const slab, const size_t index)
+{
+	if(index >= slab->capacity)
+	{ return NULL; }
+
+	return slab->base + index * slab->object_size;
+}
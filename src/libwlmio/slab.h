@@ -0,0 +1,39 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+// Fixed capacity slab of request contexts shared by the module helpers and the request tracking
+// in wlmio.c. Objects are cache line aligned and large enough for a context embedding a
+// struct wlmio_register_access, so issuing a request does not touch the heap once the slab is
+// set up. Contexts that read a whole register group at once come from a second, smaller slab of
+// SLAB_LARGE_OBJECT_SIZE objects.
+
+#define SLAB_OBJECT_SIZE 320U
+#define SLAB_LARGE_OBJECT_SIZE 2432U
+
+struct slab_object;
+
+struct slab
+{
+	uint8_t* base;
+	size_t capacity;
+	size_t object_size;
+	struct slab_object* free_list;
+};
+
+// object_size is rounded up to the object alignment
+int slab_init(struct slab* slab, size_t capacity, size_t object_size);
+void slab_deinit(struct slab* slab);
+
+/**
+ * @return Returns 0 if success, -EBUSY if all objects are in use or -ENOMEM if size does not fit
+ * an object or the slab is not set up
+*/
+int32_t slab_alloc(struct slab* slab, size_t size, void** object);
+void slab_free(struct slab* slab, void* object);
+
+// position of an object in the slab, stable for as long as the slab exists
+size_t slab_index(const struct slab* slab, const void* object);
+void* slab_object(const struct slab* slab, size_t index);
@@ -4,33 +4,95 @@
 #include <errno.h>
 #include <string.h>
 
+#include "context.h"
 #include "wlmio.h"
 
 
-static uint8_t sync_flag = 0;
-static int32_t sync_return;
+// completion state lives on the caller's stack so contexts on different threads can block independently
+struct sync_state
+{
+	uint8_t flag;
+	int32_t r;
+};
+
+
 static void sync_callback(const int32_t r, void* const uparam)
 {
-	sync_return = r;
-	sync_flag = 1;
+	struct sync_state* const sync = uparam;
+	sync->r = r;
+	sync->flag = 1;
+}
+
+
+int32_t wlmio_get_node_info_sync_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, struct wlmio_node_info* const node_info)
+{
+	struct sync_state sync = { .flag = 0, .r = 0 };
+
+	int32_t r = wlmio_get_node_info_ctx(ctx, node_id, node_info, &sync_callback, &sync);
+	if(r < 0)
+	{ goto exit; }
+
+	while(!sync.flag)
+	{
+    wlmio_wait_for_event_ctx(ctx);
+    wlmio_tick_ctx(ctx);
+  }
+
+	r = sync.r;
+
+exit:
+	return r;
 }
 
 
 int32_t wlmio_get_node_info_sync(const uint8_t node_id, struct wlmio_node_info* const node_info)
 {
-	sync_flag = 0;
+	return wlmio_get_node_info_sync_ctx(wlmio_default_ctx(), node_id, node_info);
+}
+
 
-	int32_t r = wlmio_get_node_info(node_id, node_info, &sync_callback, NULL);
+int32_t wlmio_get_register_schema_sync_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, struct wlmio_register_schema* const schema, const size_t capacity)
+{
+	struct sync_state sync = { .flag = 0, .r = 0 };
+
+	int32_t r = wlmio_get_register_schema_ctx(ctx, node_id, schema, capacity, &sync_callback, &sync);
 	if(r < 0)
 	{ goto exit; }
 
-	while(!sync_flag)
+	while(!sync.flag)
 	{
-    wlmio_wait_for_event();
-    wlmio_tick();
+    wlmio_wait_for_event_ctx(ctx);
+    wlmio_tick_ctx(ctx);
   }
 
-	r = sync_return;
+	r = sync.r;
+
+exit:
+	return r;
+}
+
+
+int32_t wlmio_get_register_schema_sync(const uint8_t node_id, struct wlmio_register_schema* const schema, const size_t capacity)
+{
+	return wlmio_get_register_schema_sync_ctx(wlmio_default_ctx(), node_id, schema, capacity);
+}
+
+
+int32_t wlmio_register_list_sync_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint16_t index, char* const name)
+{
+	struct sync_state sync = { .flag = 0, .r = 0 };
+
+	int32_t r = wlmio_register_list_ctx(ctx, node_id, index, name, &sync_callback, &sync);
+	if(r < 0)
+	{ goto exit; }
+
+	while(!sync.flag)
+	{
+    wlmio_wait_for_event_ctx(ctx);
+    wlmio_tick_ctx(ctx);
+  }
+
+	r = sync.r;
 
 exit:
 	return r;
@@ -39,19 +101,25 @@ exit:
 
 int32_t wlmio_register_list_sync(const uint8_t node_id, const uint16_t index, char* const name)
 {
-	sync_flag = 0;
+	return wlmio_register_list_sync_ctx(wlmio_default_ctx(), node_id, index, name);
+}
+
+
+int32_t wlmio_register_access_sync_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const char* const name, const struct wlmio_register_access* const regw, struct wlmio_register_access* const regr)
+{
+	struct sync_state sync = { .flag = 0, .r = 0 };
 
-	int32_t r = wlmio_register_list(node_id, index, name, &sync_callback, NULL);
+	int32_t r = wlmio_register_access_ctx(ctx, node_id, name, regw, regr, &sync_callback, &sync);
 	if(r < 0)
 	{ goto exit; }
 
-	while(!sync_flag)
+	while(!sync.flag)
 	{
-    wlmio_wait_for_event();
-    wlmio_tick();
+    wlmio_wait_for_event_ctx(ctx);
+    wlmio_tick_ctx(ctx);
   }
 
-	r = sync_return;
+	r = sync.r;
 
 exit:
 	return r;
@@ -60,19 +128,25 @@ exit:
 
 int32_t wlmio_register_access_sync(const uint8_t node_id, const char* const name, const struct wlmio_register_access* const regw, struct wlmio_register_access* const regr)
 {
-	sync_flag = 0;
+	return wlmio_register_access_sync_ctx(wlmio_default_ctx(), node_id, name, regw, regr);
+}
+
+
+int32_t wlmio_execute_command_sync_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint16_t command, const void* const param, size_t param_len)
+{
+	struct sync_state sync = { .flag = 0, .r = 0 };
 
-	int32_t r = wlmio_register_access(node_id, name, regw, regr, &sync_callback, NULL);
+	int32_t r = wlmio_execute_command_ctx(ctx, node_id, command, param, param_len, &sync_callback, &sync);
 	if(r < 0)
 	{ goto exit; }
 
-	while(!sync_flag)
+	while(!sync.flag)
 	{
-    wlmio_wait_for_event();
-    wlmio_tick();
+    wlmio_wait_for_event_ctx(ctx);
+    wlmio_tick_ctx(ctx);
   }
 
-	r = sync_return;
+	r = sync.r;
 
 exit:
 	return r;
@@ -81,19 +155,25 @@ exit:
 
 int32_t wlmio_execute_command_sync(const uint8_t node_id, const uint16_t command, const void* const param, size_t param_len)
 {
-	sync_flag = 0;
+	return wlmio_execute_command_sync_ctx(wlmio_default_ctx(), node_id, command, param, param_len);
+}
+
+
+int32_t wlmio_vpe6010_read_sync_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, struct wlmio_vpe6010_input* const dst)
+{
+  struct sync_state sync = { .flag = 0, .r = 0 };
 
-	int32_t r = wlmio_execute_command(node_id, command, param, param_len, &sync_callback, NULL);
+	int32_t r = wlmio_vpe6010_read_ctx(ctx, node_id, dst, sync_callback, &sync);
 	if(r < 0)
 	{ goto exit; }
 
-	while(!sync_flag)
+	while(!sync.flag)
 	{
-    wlmio_wait_for_event();
-    wlmio_tick();
+    wlmio_wait_for_event_ctx(ctx);
+    wlmio_tick_ctx(ctx);
   }
 
-	r = sync_return;
+	r = sync.r;
 
 exit:
 	return r;
@@ -102,19 +182,25 @@ exit:
 
 int32_t wlmio_vpe6010_read_sync(const uint8_t node_id, struct wlmio_vpe6010_input* const dst)
 {
-  sync_flag = 0;
+	return wlmio_vpe6010_read_sync_ctx(wlmio_default_ctx(), node_id, dst);
+}
+
+
+int32_t wlmio_vpe6030_write_sync_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint8_t ch, const uint8_t v)
+{
+	struct sync_state sync = { .flag = 0, .r = 0 };
 
-	int32_t r = wlmio_vpe6010_read(node_id, dst, sync_callback, NULL);
+	int32_t r = wlmio_vpe6030_write_ctx(ctx, node_id, ch, v, sync_callback, &sync);
 	if(r < 0)
 	{ goto exit; }
 
-	while(!sync_flag)
+	while(!sync.flag)
 	{
-    wlmio_wait_for_event();
-    wlmio_tick();
+    wlmio_wait_for_event_ctx(ctx);
+    wlmio_tick_ctx(ctx);
   }
 
-	r = sync_return;
+	r = sync.r;
 
 exit:
 	return r;
@@ -123,19 +209,25 @@ exit:
 
 int32_t wlmio_vpe6030_write_sync(const uint8_t node_id, const uint8_t ch, const uint8_t v)
 {
-	sync_flag = 0;
+	return wlmio_vpe6030_write_sync_ctx(wlmio_default_ctx(), node_id, ch, v);
+}
+
+
+int32_t wlmio_vpe6040_read_sync_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint8_t ch, uint16_t* const v)
+{
+  struct sync_state sync = { .flag = 0, .r = 0 };
 
-	int32_t r = wlmio_vpe6030_write(node_id, ch, v, sync_callback, NULL);
+	int32_t r = wlmio_vpe6040_read_ctx(ctx, node_id, ch, v, sync_callback, &sync);
 	if(r < 0)
 	{ goto exit; }
 
-	while(!sync_flag)
+	while(!sync.flag)
 	{
-    wlmio_wait_for_event();
-    wlmio_tick();
+    wlmio_wait_for_event_ctx(ctx);
+    wlmio_tick_ctx(ctx);
   }
 
-	r = sync_return;
+	r = sync.r;
 
 exit:
 	return r;
@@ -144,19 +236,25 @@ exit:
 
 int32_t wlmio_vpe6040_read_sync(const uint8_t node_id, const uint8_t ch, uint16_t* const v)
 {
-  sync_flag = 0;
+	return wlmio_vpe6040_read_sync_ctx(wlmio_default_ctx(), node_id, ch, v);
+}
+
+
+int32_t wlmio_vpe6040_configure_sync_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint8_t ch, const uint8_t mode)
+{
+	struct sync_state sync = { .flag = 0, .r = 0 };
 
-	int32_t r = wlmio_vpe6040_read(node_id, ch, v, sync_callback, NULL);
+	int32_t r = wlmio_vpe6040_configure_ctx(ctx, node_id, ch, mode, sync_callback, &sync);
 	if(r < 0)
 	{ goto exit; }
 
-	while(!sync_flag)
+	while(!sync.flag)
 	{
-    wlmio_wait_for_event();
-    wlmio_tick();
+    wlmio_wait_for_event_ctx(ctx);
+    wlmio_tick_ctx(ctx);
   }
 
-	r = sync_return;
+	r = sync.r;
 
 exit:
 	return r;
@@ -165,19 +263,25 @@ exit:
 
 int32_t wlmio_vpe6040_configure_sync(const uint8_t node_id, const uint8_t ch, const uint8_t mode)
 {
-	sync_flag = 0;
+	return wlmio_vpe6040_configure_sync_ctx(wlmio_default_ctx(), node_id, ch, mode);
+}
+
+
+int32_t wlmio_vpe6050_write_sync_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint8_t ch, const uint16_t v)
+{
+	struct sync_state sync = { .flag = 0, .r = 0 };
 
-	int32_t r = wlmio_vpe6040_configure(node_id, ch, mode, sync_callback, NULL);
+	int32_t r = wlmio_vpe6050_write_ctx(ctx, node_id, ch, v, sync_callback, &sync);
 	if(r < 0)
 	{ goto exit; }
 
-	while(!sync_flag)
+	while(!sync.flag)
 	{
-    wlmio_wait_for_event();
-    wlmio_tick();
+    wlmio_wait_for_event_ctx(ctx);
+    wlmio_tick_ctx(ctx);
   }
 
-	r = sync_return;
+	r = sync.r;
 
 exit:
 	return r;
@@ -186,19 +290,25 @@ exit:
 
 int32_t wlmio_vpe6050_write_sync(const uint8_t node_id, const uint8_t ch, const uint16_t v)
 {
-	sync_flag = 0;
+	return wlmio_vpe6050_write_sync_ctx(wlmio_default_ctx(), node_id, ch, v);
+}
+
 
-	int32_t r = wlmio_vpe6050_write(node_id, ch, v, sync_callback, NULL);
+int32_t wlmio_vpe6050_configure_sync_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint8_t ch, const uint8_t mode)
+{
+	struct sync_state sync = { .flag = 0, .r = 0 };
+
+	int32_t r = wlmio_vpe6050_configure_ctx(ctx, node_id, ch, mode, sync_callback, &sync);
 	if(r < 0)
 	{ goto exit; }
 
-	while(!sync_flag)
+	while(!sync.flag)
 	{
-    wlmio_wait_for_event();
-    wlmio_tick();
+    wlmio_wait_for_event_ctx(ctx);
+    wlmio_tick_ctx(ctx);
   }
 
-	r = sync_return;
+	r = sync.r;
 
 exit:
 	return r;
@@ -207,19 +317,25 @@ exit:
 
 int32_t wlmio_vpe6050_configure_sync(const uint8_t node_id, const uint8_t ch, const uint8_t mode)
 {
-	sync_flag = 0;
+	return wlmio_vpe6050_configure_sync_ctx(wlmio_default_ctx(), node_id, ch, mode);
+}
 
-	int32_t r = wlmio_vpe6050_configure(node_id, ch, mode, sync_callback, NULL);
+
+int32_t wlmio_vpe6060_read_sync_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint8_t ch, uint32_t* const v)
+{
+	struct sync_state sync = { .flag = 0, .r = 0 };
+
+	int32_t r = wlmio_vpe6060_read_ctx(ctx, node_id, ch, v, sync_callback, &sync);
 	if(r < 0)
 	{ goto exit; }
 
-	while(!sync_flag)
+	while(!sync.flag)
 	{
-    wlmio_wait_for_event();
-    wlmio_tick();
+    wlmio_wait_for_event_ctx(ctx);
+    wlmio_tick_ctx(ctx);
   }
 
-	r = sync_return;
+	r = sync.r;
 
 exit:
 	return r;
@@ -228,19 +344,25 @@ exit:
 
 int32_t wlmio_vpe6060_read_sync(const uint8_t node_id, const uint8_t ch, uint32_t* const v)
 {
-	sync_flag = 0;
+	return wlmio_vpe6060_read_sync_ctx(wlmio_default_ctx(), node_id, ch, v);
+}
 
-	int32_t r = wlmio_vpe6060_read(node_id, ch, v, sync_callback, NULL);
+
+int32_t wlmio_vpe6060_configure_sync_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint8_t ch, const uint8_t mode, const uint8_t polarity, const uint8_t bias)
+{
+	struct sync_state sync = { .flag = 0, .r = 0 };
+
+	int32_t r = wlmio_vpe6060_configure_ctx(ctx, node_id, ch, mode, polarity, bias, sync_callback, &sync);
 	if(r < 0)
 	{ goto exit; }
 
-	while(!sync_flag)
+	while(!sync.flag)
 	{
-    wlmio_wait_for_event();
-    wlmio_tick();
+    wlmio_wait_for_event_ctx(ctx);
+    wlmio_tick_ctx(ctx);
   }
 
-	r = sync_return;
+	r = sync.r;
 
 exit:
 	return r;
@@ -249,19 +371,25 @@ exit:
 
 int32_t wlmio_vpe6060_configure_sync(const uint8_t node_id, const uint8_t ch, const uint8_t mode, const uint8_t polarity, const uint8_t bias)
 {
-	sync_flag = 0;
+	return wlmio_vpe6060_configure_sync_ctx(wlmio_default_ctx(), node_id, ch, mode, polarity, bias);
+}
+
+
+int32_t wlmio_vpe6070_write_sync_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint8_t ch, const uint16_t v)
+{
+	struct sync_state sync = { .flag = 0, .r = 0 };
 
-	int32_t r = wlmio_vpe6060_configure(node_id, ch, mode, polarity, bias, sync_callback, NULL);
+	int32_t r = wlmio_vpe6070_write_ctx(ctx, node_id, ch, v, sync_callback, &sync);
 	if(r < 0)
 	{ goto exit; }
 
-	while(!sync_flag)
+	while(!sync.flag)
 	{
-    wlmio_wait_for_event();
-    wlmio_tick();
+    wlmio_wait_for_event_ctx(ctx);
+    wlmio_tick_ctx(ctx);
   }
 
-	r = sync_return;
+	r = sync.r;
 
 exit:
 	return r;
@@ -270,19 +398,25 @@ exit:
 
 int32_t wlmio_vpe6070_write_sync(const uint8_t node_id, const uint8_t ch, const uint16_t v)
 {
-	sync_flag = 0;
+	return wlmio_vpe6070_write_sync_ctx(wlmio_default_ctx(), node_id, ch, v);
+}
 
-	int32_t r = wlmio_vpe6070_write(node_id, ch, v, sync_callback, NULL);
+
+int32_t wlmio_vpe6080_read_sync_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint8_t ch, uint16_t* const v)
+{
+	struct sync_state sync = { .flag = 0, .r = 0 };
+
+	int32_t r = wlmio_vpe6080_read_ctx(ctx, node_id, ch, v, sync_callback, &sync);
 	if(r < 0)
 	{ goto exit; }
 
-	while(!sync_flag)
+	while(!sync.flag)
 	{
-    wlmio_wait_for_event();
-    wlmio_tick();
+    wlmio_wait_for_event_ctx(ctx);
+    wlmio_tick_ctx(ctx);
   }
 
-	r = sync_return;
+	r = sync.r;
 
 exit:
 	return r;
@@ -291,19 +425,25 @@ exit:
 
 int32_t wlmio_vpe6080_read_sync(const uint8_t node_id, const uint8_t ch, uint16_t* const v)
 {
-	sync_flag = 0;
+	return wlmio_vpe6080_read_sync_ctx(wlmio_default_ctx(), node_id, ch, v);
+}
+
+
+int32_t wlmio_vpe6080_configure_sync_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint8_t ch, const uint8_t enabled, const uint16_t beta, const uint16_t t0)
+{
+	struct sync_state sync = { .flag = 0, .r = 0 };
 
-	int32_t r = wlmio_vpe6080_read(node_id, ch, v, sync_callback, NULL);
+	int32_t r = wlmio_vpe6080_configure_ctx(ctx, node_id, ch, enabled, beta, t0, sync_callback, &sync);
 	if(r < 0)
 	{ goto exit; }
 
-	while(!sync_flag)
+	while(!sync.flag)
 	{
-    wlmio_wait_for_event();
-    wlmio_tick();
+    wlmio_wait_for_event_ctx(ctx);
+    wlmio_tick_ctx(ctx);
   }
 
-	r = sync_return;
+	r = sync.r;
 
 exit:
 	return r;
@@ -312,19 +452,25 @@ exit:
 
 int32_t wlmio_vpe6080_configure_sync(const uint8_t node_id, const uint8_t ch, const uint8_t enabled, const uint16_t beta, const uint16_t t0)
 {
-	sync_flag = 0;
+	return wlmio_vpe6080_configure_sync_ctx(wlmio_default_ctx(), node_id, ch, enabled, beta, t0);
+}
+
+
+int32_t wlmio_node_set_sample_interval_sync_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint16_t sample_interval)
+{
+	struct sync_state sync = { .flag = 0, .r = 0 };
 
-	int32_t r = wlmio_vpe6080_configure(node_id, ch, enabled, beta, t0, sync_callback, NULL);
+	int32_t r = wlmio_node_set_sample_interval_ctx(ctx, node_id, sample_interval, sync_callback, &sync);
 	if(r < 0)
 	{ goto exit; }
 
-	while(!sync_flag)
+	while(!sync.flag)
 	{
-    wlmio_wait_for_event();
-    wlmio_tick();
+    wlmio_wait_for_event_ctx(ctx);
+    wlmio_tick_ctx(ctx);
   }
 
-	r = sync_return;
+	r = sync.r;
 
 exit:
 	return r;
@@ -333,40 +479,52 @@ exit:
 
 int32_t wlmio_node_set_sample_interval_sync(const uint8_t node_id, const uint16_t sample_interval)
 {
-	sync_flag = 0;
+	return wlmio_node_set_sample_interval_sync_ctx(wlmio_default_ctx(), node_id, sample_interval);
+}
 
-	int32_t r = wlmio_node_set_sample_interval(node_id, sample_interval, sync_callback, NULL);
-	if(r < 0)
-	{ goto exit; }
 
-	while(!sync_flag)
-	{
-    wlmio_wait_for_event();
-    wlmio_tick();
+int32_t wlmio_vpe6090_read_sync_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint8_t ch, uint16_t* const v)
+{
+  struct sync_state sync = { .flag = 0, .r = 0 };
+
+  int32_t r = wlmio_vpe6090_read_ctx(ctx, node_id, ch, v, sync_callback, &sync);
+  if(r < 0)
+  { goto exit; }
+
+  while(!sync.flag)
+  {
+    wlmio_wait_for_event_ctx(ctx);
+    wlmio_tick_ctx(ctx);
   }
 
-	r = sync_return;
+  r = sync.r;
 
 exit:
-	return r;
+  return r;
 }
 
 
 int32_t wlmio_vpe6090_read_sync(const uint8_t node_id, const uint8_t ch, uint16_t* const v)
 {
-  sync_flag = 0;
+	return wlmio_vpe6090_read_sync_ctx(wlmio_default_ctx(), node_id, ch, v);
+}
+
 
-  int32_t r = wlmio_vpe6090_read(node_id, ch, v, sync_callback, NULL);
+int32_t wlmio_vpe6090_configure_sync_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint8_t ch, const uint8_t type)
+{
+  struct sync_state sync = { .flag = 0, .r = 0 };
+
+  int32_t r = wlmio_vpe6090_configure_ctx(ctx, node_id, ch, type, sync_callback, &sync);
   if(r < 0)
   { goto exit; }
 
-  while(!sync_flag)
+  while(!sync.flag)
   {
-    wlmio_wait_for_event();
-    wlmio_tick();
+    wlmio_wait_for_event_ctx(ctx);
+    wlmio_tick_ctx(ctx);
   }
 
-  r = sync_return;
+  r = sync.r;
 
 exit:
   return r;
@@ -375,19 +533,25 @@ exit:
 
 int32_t wlmio_vpe6090_configure_sync(const uint8_t node_id, const uint8_t ch, const uint8_t type)
 {
-  sync_flag = 0;
+	return wlmio_vpe6090_configure_sync_ctx(wlmio_default_ctx(), node_id, ch, type);
+}
+
+
+int32_t wlmio_vpe6180_read_sync_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint8_t ch, uint16_t* const v)
+{
+  struct sync_state sync = { .flag = 0, .r = 0 };
 
-  int32_t r = wlmio_vpe6090_configure(node_id, ch, type, sync_callback, NULL);
+  int32_t r = wlmio_vpe6180_read_ctx(ctx, node_id, ch, v, sync_callback, &sync);
   if(r < 0)
   { goto exit; }
 
-  while(!sync_flag)
+  while(!sync.flag)
   {
-    wlmio_wait_for_event();
-    wlmio_tick();
+    wlmio_wait_for_event_ctx(ctx);
+    wlmio_tick_ctx(ctx);
   }
 
-  r = sync_return;
+  r = sync.r;
 
 exit:
   return r;
@@ -396,19 +560,25 @@ exit:
 
 int32_t wlmio_vpe6180_read_sync(const uint8_t node_id, const uint8_t ch, uint16_t* const v)
 {
-  sync_flag = 0;
+	return wlmio_vpe6180_read_sync_ctx(wlmio_default_ctx(), node_id, ch, v);
+}
+
 
-  int32_t r = wlmio_vpe6180_read(node_id, ch, v, sync_callback, NULL);
+int32_t wlmio_vpe6190_configure_sync_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint8_t ch, uint8_t enable)
+{
+  struct sync_state sync = { .flag = 0, .r = 0 };
+
+  int32_t r = wlmio_vpe6190_configure_ctx(ctx, node_id, ch, enable, sync_callback, &sync);
   if(r < 0)
   { goto exit; }
 
-  while(!sync_flag)
+  while(!sync.flag)
   {
-    wlmio_wait_for_event();
-    wlmio_tick();
+    wlmio_wait_for_event_ctx(ctx);
+    wlmio_tick_ctx(ctx);
   }
 
-  r = sync_return;
+  r = sync.r;
 
 exit:
   return r;
@@ -417,19 +587,25 @@ exit:
 
 int32_t wlmio_vpe6190_configure_sync(const uint8_t node_id, const uint8_t ch, uint8_t enable)
 {
-  sync_flag = 0;
+	return wlmio_vpe6190_configure_sync_ctx(wlmio_default_ctx(), node_id, ch, enable);
+}
+
+
+int32_t wlmio_vpe6190_read_sync_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint8_t ch, uint32_t* const v)
+{
+  struct sync_state sync = { .flag = 0, .r = 0 };
 
-  int32_t r = wlmio_vpe6190_configure(node_id, ch, enable, sync_callback, NULL);
+  int32_t r = wlmio_vpe6190_read_ctx(ctx, node_id, ch, v, sync_callback, &sync);
   if(r < 0)
   { goto exit; }
 
-  while(!sync_flag)
+  while(!sync.flag)
   {
-    wlmio_wait_for_event();
-    wlmio_tick();
+    wlmio_wait_for_event_ctx(ctx);
+    wlmio_tick_ctx(ctx);
   }
 
-  r = sync_return;
+  r = sync.r;
 
 exit:
   return r;
@@ -438,20 +614,5 @@ exit:
 
 int32_t wlmio_vpe6190_read_sync(const uint8_t node_id, const uint8_t ch, uint32_t* const v)
 {
-  sync_flag = 0;
-
-  int32_t r = wlmio_vpe6190_read(node_id, ch, v, sync_callback, NULL);
-  if(r < 0)
-  { goto exit; }
-
-  while(!sync_flag)
-  {
-    wlmio_wait_for_event();
-    wlmio_tick();
-  }
-
-  r = sync_return;
-
-exit:
-  return r;
+	return wlmio_vpe6190_read_sync_ctx(wlmio_default_ctx(), node_id, ch, v);
 }
\ No newline at end of file
@@ -1,5 +1,7 @@
 // #define _POSIX_C_SOURCE 200809L
+#define _GNU_SOURCE
 
+#include <stdatomic.h>
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
@@ -13,9 +15,12 @@
 #include <sys/socket.h>
 #include <linux/can.h>
 #include <linux/can/raw.h>
+#include <linux/errqueue.h>
 #include <linux/if.h>
+#include <linux/net_tstamp.h>
 #include <linux/sockios.h>
 #include <sys/epoll.h>
+#include <sys/eventfd.h>
 #include <sys/ioctl.h>
 #include <sys/time.h>
 #include <sys/timerfd.h>
@@ -25,101 +30,450 @@
 #include <canard_dsdl.h>
 #include <gpiod.h>
 
+#include "context.h"
+#include "mpsc.h"
+#include "pool.h"
+#include "schema.h"
+#include "slab.h"
 #include "wlmio.h"
 
-static void* mem_allocate(CanardInstance* const ins, const size_t amount)
-{ return malloc(amount); }
 
-static void mem_free(CanardInstance* const ins, void* const pointer)
-{ free(pointer); }
+// number of epoll events fetched per epoll_wait() call in wlmio_tick()
+#ifndef WLMIO_EPOLL_BATCH_SIZE
+#define WLMIO_EPOLL_BATCH_SIZE 16
+#endif
+
+// maximum number of frames read from the CAN socket per wakeup, the socket is level triggered so
+// anything left over is picked up by the next batch
+#ifndef WLMIO_CAN_RX_BUDGET
+#define WLMIO_CAN_RX_BUDGET 256
+#endif
+
+// number of frames written to the CAN socket per sendmmsg() call
+#ifndef WLMIO_CAN_TX_BATCH_SIZE
+#define WLMIO_CAN_TX_BATCH_SIZE 32
+#endif
+
+// delay before retrying frames the CAN interface queue had no room for, in microseconds
+#ifndef WLMIO_CAN_TX_RETRY_INTERVAL
+#define WLMIO_CAN_TX_RETRY_INTERVAL 1000ULL
+#endif
+
+// number of frames read from the CAN socket per recvmmsg() call
+#ifndef WLMIO_CAN_RX_BATCH_SIZE
+#define WLMIO_CAN_RX_BATCH_SIZE 32
+#endif
+
+// maximum number of kernel CAN filter rules, if there are more subscriptions than this the
+// socket accepts everything and libcanard does the filtering on its own
+#ifndef WLMIO_CAN_FILTER_MAX
+#define WLMIO_CAN_FILTER_MAX 32
+#endif
+
+// number of request contexts in the slab shared by the module helpers and request tracking
+#ifndef WLMIO_REQUEST_SLAB_CAPACITY
+#define WLMIO_REQUEST_SLAB_CAPACITY 1024
+#endif
+
+// number of register group read contexts, which are too large for the request slab
+#ifndef WLMIO_GROUP_SLAB_CAPACITY
+#define WLMIO_GROUP_SLAB_CAPACITY 32
+#endif
+
+// time without a heartbeat after which a node is considered offline, in microseconds
+#ifndef WLMIO_HEARTBEAT_TIMEOUT
+#define WLMIO_HEARTBEAT_TIMEOUT 3000000ULL
+#endif
+
+// size of the block pool backing all libcanard allocations
+#ifndef WLMIO_POOL_ARENA_SIZE
+#define WLMIO_POOL_ARENA_SIZE (256 * 1024)
+#endif
+
+// default number of requests that may be awaiting a response from one node at a time, further
+// requests wait in the node's queue
+#ifndef WLMIO_NODE_REQUEST_LIMIT
+#define WLMIO_NODE_REQUEST_LIMIT 8
+#endif
+
+// number of requests other threads can have queued for the event loop thread
+#ifndef WLMIO_SUBMIT_QUEUE_CAPACITY
+#define WLMIO_SUBMIT_QUEUE_CAPACITY 256
+#endif
+
+// pool settings picked up by contexts opened from now on
+static size_t pool_arena_size = WLMIO_POOL_ARENA_SIZE;
+static bool pool_lock_memory = false;
+
+
+struct wlmio_ctx;
+
+struct fd_entry
+{
+	int fd;
+	uint32_t events;
+	void (* handler)(struct wlmio_ctx*, struct fd_entry*, uint32_t events);
+	struct fd_entry* next;
+	struct fd_entry* previous;
+};
 
-static CanardInstance canard;
 
-static int epollfd = -1;
+struct task_entry
+{
+	uint32_t id;
+	struct timer_entry timer;
+	void* param;
+	void (*callback)(int32_t r, void* uparam);
+	void* uparam;
 
-static struct wlmio_status nodes[CANARD_NODE_ID_MAX + 1U];
-static int timers[CANARD_NODE_ID_MAX + 1U];
+	uint8_t node_id;
+	uint8_t service;
+	uint8_t transfer_id;
+	uint8_t priority;
 
-static void (* user_callback)(uint8_t node_id, const struct wlmio_status* old_status, const struct wlmio_status* new_status);
+	// monotonic time after which the request frames are no longer worth sending, 0 for none
+	uint64_t tx_deadline;
 
+	// set while the request waits in its node's queue, the payload is then held in the pool
+	bool queued;
+	struct task_entry* next;
+	void* payload;
+	size_t payload_size;
 
-struct fd_entry
+	// set for a reader of a coalesced register read, which owns no transfer of its own and is
+	// linked into the read's waiters through next
+	struct read_flight* flight;
+};
+
+
+// Reads of a register that is already being read from the same node join the pending read
+// instead of issuing another transfer. Every reader is a waiter with a handle of its own, the
+// transfer is a request of the flight that is only dropped once the last waiter has left. The
+// response is written to regr, the buffer of one of the waiters, and copied to the others before
+// any callback runs. A read only joins a flight that answers no later than its own request would
+// time out or be dropped, and a flight takes no more readers once a write to its register has been
+// issued behind it, as they would be answered with the value from before the write.
+struct read_flight
 {
-	int fd;
-	void (* handler)(struct fd_entry*);
-	struct fd_entry* next;
-	struct fd_entry* previous;
+	struct wlmio_ctx* ctx;
+	struct read_flight* next;
+	uint8_t node_id;
+	uint8_t priority;
+	bool joinable;
+	char name[51];
+	uint64_t timeout_at;
+	uint64_t tx_deadline;
+	int64_t handle;
+	struct wlmio_register_access* regr;
+	struct task_entry* waiters;
+	struct task_entry** waiters_tail;
+};
+
+// One wlmio_register_access_many() call. Every operation is issued with its own slot in members
+// as uparam, the slot points back at the group and its offset gives the operation index.
+struct register_group
+{
+	struct register_group* members[WLMIO_REGISTER_OPS_MAX];
+	struct wlmio_register_op* ops;
+	struct wlmio_ctx* ctx;
+	void (* callback)(int32_t r, void* uparam);
+	void* uparam;
+	size_t n;
+	size_t remaining;
 };
-static struct fd_entry* fd_entry_head = NULL;
 
 
-static struct fd_entry* fd_entry_find(int fd)
+// Services whose transfer IDs are handed out per node. A transfer ID is only reused once the
+// response to its previous request has arrived or timed out, so the 5 bit window can never pair
+// a response with the wrong request.
+enum request_service
+{
+	REQUEST_SERVICE_NODE_INFO = 0,
+	REQUEST_SERVICE_REGISTER_LIST = 1,
+	REQUEST_SERVICE_REGISTER_ACCESS = 2,
+	REQUEST_SERVICE_EXECUTE_COMMAND = 3,
+	REQUEST_SERVICE_COUNT = 4
+};
+
+static const CanardPortID request_port_ids[REQUEST_SERVICE_COUNT] = { 430U, 385U, 384U, 435U };
+
+
+// Pending requests are kept in an open-addressed hash table keyed by the 21-bit response
+// specifier (node ID, transfer ID, service ID) with linear probing. Entries are removed by
+// shifting the following cluster back so lookups never have to skip tombstones. Entries sharing
+// a key stay in insertion order, so the oldest request is matched first.
+#define TASK_TABLE_BITS 12U
+#define TASK_TABLE_SIZE (1U << TASK_TABLE_BITS)
+#define TASK_TABLE_MAX_LOAD (TASK_TABLE_SIZE / 4U * 3U)
+
+
+// Request descriptor queued by wlmio_submit_*() on any thread and issued by the event loop thread.
+// Everything the request needs is copied in so the caller's buffers may go away after submitting,
+// except for the read buffer which is filled in when the response arrives.
+enum submit_kind
+{
+	SUBMIT_REGISTER_ACCESS = 0,
+	SUBMIT_EXECUTE_COMMAND = 1
+};
+
+struct submit_entry
 {
-	struct fd_entry* c = fd_entry_head;
-	while(c)
+	uint8_t kind;
+	uint8_t node_id;
+	struct wlmio_cq* cq;
+	void (* callback)(int32_t r, void* uparam);
+	void* uparam;
+
+	union
 	{
-		if(c->fd == fd)
-		{ break; }
+		struct
+		{
+			char name[51];
+			bool write;
+			struct wlmio_register_access regw;
+			struct wlmio_register_access* regr;
+		} reg;
 
-		c = c->next;
-	}
+		struct
+		{
+			uint16_t command;
+			uint8_t param_len;
+			uint8_t param[112];
+		} cmd;
+	};
+};
 
-	return c;
+
+// Completions for requests submitted with a completion queue are handed back through another MPSC
+// queue and run by whichever thread calls wlmio_cq_dispatch(). Submitting reserves a slot so the
+// event loop thread never finds the queue full.
+struct wlmio_cq
+{
+	struct mpsc queue;
+	int fd;
+	size_t capacity;
+	atomic_size_t outstanding;
+};
+
+struct cq_entry
+{
+	void (* callback)(int32_t r, void* uparam);
+	void* uparam;
+	int32_t r;
+};
+
+
+// receive buffers for recvmmsg(), each frame carries its timestamp in a control message
+#define CAN_RX_CONTROL_SIZE (CMSG_SPACE(sizeof(struct timespec) * 3) + CMSG_SPACE(sizeof(struct timeval)))
+
+
+// Everything belonging to one CAN interface. Contexts share no mutable state, so each one can be
+// driven from its own thread.
+struct wlmio_ctx
+{
+	CanardInstance canard;
+	struct pool pool;
+	struct slab slab;
+	struct slab group_slab;
+
+	int epollfd;
+	int can_sock;
+	struct fd_entry* can_entry;
+	struct fd_entry* fd_entry_head;
+	struct fd_entry* fd_entry_tail;
+
+	struct wlmio_status nodes[CANARD_NODE_ID_MAX + 1U];
+	void (* user_callback)(uint8_t node_id, const struct wlmio_status* old_status, const struct wlmio_status* new_status);
+
+	// timeout in microseconds
+	uint64_t timeout;
+
+	struct timer_entry** timer_heap;
+	size_t timer_count;
+	size_t timer_capacity;
+	int timer_fd;
+	uint64_t timer_armed;
+
+	struct task_entry* task_table[TASK_TABLE_SIZE];
+	size_t task_count;
+
+	// Request handles are the slab index of the task entry in the low 16 bits and the generation
+	// of that slab object in the high bits. The generation moves on whenever a task entry is
+	// released, so a stale handle never matches a request issued later in the same object.
+	uint16_t task_generations[WLMIO_REQUEST_SLAB_CAPACITY];
+
+	// fail pending requests of a node with -EHOSTDOWN as soon as its heartbeat times out
+	bool offline_fails_requests;
+
+	// register reads awaiting a response, see struct read_flight
+	struct read_flight* read_flights;
+
+	struct schema_cache schema_cache;
+
+	// Liveness is tracked lazily: a heartbeat only records when the node was last seen and the
+	// node's timer is left alone while it is scheduled. When the timer fires the handler checks
+	// the last seen time and pushes the timer out to the real deadline if the node has been heard
+	// from since, so the heap is touched about once per timeout period per node rather than per
+	// heartbeat.
+	struct timer_entry heartbeat_timers[CANARD_NODE_ID_MAX + 1U];
+	uint64_t heartbeat_last_seen[CANARD_NODE_ID_MAX + 1U];
+	uint64_t heartbeat_timeouts[CANARD_NODE_ID_MAX + 1U];
+
+	// monotonic time at which the frames currently being dispatched were read from the socket
+	uint64_t rx_time_usec;
+
+	// transfer IDs awaiting a response as a bit mask and the next transfer ID to try, per service
+	// and node
+	uint32_t tfr_busy[REQUEST_SERVICE_COUNT][CANARD_NODE_ID_MAX + 1U];
+	uint8_t tfr_next[REQUEST_SERVICE_COUNT][CANARD_NODE_ID_MAX + 1U];
+
+	// Requests that could not be issued right away wait in a FIFO per node until a transfer ID and
+	// a concurrency slot are free, a request is never issued ahead of an older one to the same node.
+	struct task_entry* node_queue_head[CANARD_NODE_ID_MAX + 1U];
+	struct task_entry** node_queue_tail[CANARD_NODE_ID_MAX + 1U];
+	uint16_t node_inflight[CANARD_NODE_ID_MAX + 1U];
+	uint16_t node_limits[CANARD_NODE_ID_MAX + 1U];
+
+	CanardRxSubscription register_list_subscription;
+	CanardRxSubscription register_access_subscription;
+	CanardRxSubscription command_subscription;
+	CanardRxSubscription node_info_subscription;
+	CanardRxSubscription heartbeat_subscription;
+
+	// requests submitted from other threads, submit_pending is set while a wakeup is outstanding on
+	// submit_fd so a burst of submissions costs one eventfd write
+	struct mpsc submit_queue;
+	int submit_fd;
+	atomic_bool submit_pending;
+
+	// Frames are moved out of the libcanard queue into a staging buffer and written with a single
+	// sendmmsg() call. Frames the socket could not take stay staged, and the CAN socket is watched
+	// for EPOLLOUT so they go out as soon as there is room rather than on the next unrelated event.
+	// When the interface queue is full instead (ENOBUFS) the socket keeps polling writable, so the
+	// frames are retried from can_tx_retry.
+	struct canfd_frame can_tx_frames[WLMIO_CAN_TX_BATCH_SIZE];
+	struct iovec can_tx_iov[WLMIO_CAN_TX_BATCH_SIZE];
+	struct mmsghdr can_tx_msgs[WLMIO_CAN_TX_BATCH_SIZE];
+	uint64_t can_tx_deadlines[WLMIO_CAN_TX_BATCH_SIZE];
+	size_t can_tx_count;
+	struct timer_entry can_tx_retry;
+
+	// frames dropped because their transmission deadline passed before they reached the socket
+	uint64_t tx_expired;
+
+	// while nonzero requests are left in the libcanard queue, so a batch of them is handed to the
+	// socket by a single uavcan_send()
+	uint32_t tx_corked;
+
+	struct canfd_frame can_rx_frames[WLMIO_CAN_RX_BATCH_SIZE];
+	struct iovec can_rx_iov[WLMIO_CAN_RX_BATCH_SIZE];
+	struct mmsghdr can_rx_msgs[WLMIO_CAN_RX_BATCH_SIZE];
+	uint8_t can_rx_control[WLMIO_CAN_RX_BATCH_SIZE][CAN_RX_CONTROL_SIZE] __attribute__((aligned(8)));
+};
+
+// context used by the functions without a _ctx suffix
+static struct wlmio_ctx* default_ctx = NULL;
+
+
+static void* mem_allocate(CanardInstance* const ins, const size_t amount)
+{
+	struct wlmio_ctx* const ctx = ins->user_reference;
+	return pool_alloc(&ctx->pool, amount);
+}
+
+static void mem_free(CanardInstance* const ins, void* const pointer)
+{
+	struct wlmio_ctx* const ctx = ins->user_reference;
+	pool_free(&ctx->pool, pointer);
+}
+
+
+struct wlmio_ctx* wlmio_default_ctx(void)
+{
+	return default_ctx;
+}
+
+
+struct slab* wlmio_ctx_slab(struct wlmio_ctx* const ctx)
+{
+	return &ctx->slab;
+}
+
+
+struct slab* wlmio_ctx_group_slab(struct wlmio_ctx* const ctx)
+{
+	return &ctx->group_slab;
+}
+
+
+struct schema_cache* wlmio_ctx_schema_cache(struct wlmio_ctx* const ctx)
+{
+	return &ctx->schema_cache;
 }
 
 
-static void fd_entry_close(struct fd_entry* const entry)
+static void fd_entry_close(struct wlmio_ctx* const ctx, struct fd_entry* const entry)
 {
 	assert(entry);
 
 	if(entry->previous)
 	{ entry->previous->next = entry->next; }
 	else
-	{ fd_entry_head = entry->next; }
+	{ ctx->fd_entry_head = entry->next; }
 
 	if(entry->next)
 	{ entry->next->previous = entry->previous; }
+	else
+	{ ctx->fd_entry_tail = entry->previous; }
 
 	close(entry->fd);
 	free(entry);
 }
 
 
-static struct fd_entry* fd_entry_add(int fd, void (* const handler)(struct fd_entry*), uint32_t events)
+static struct fd_entry* fd_entry_add(struct wlmio_ctx* const ctx, int fd, void (* const handler)(struct wlmio_ctx*, struct fd_entry*, uint32_t events), uint32_t events)
 {
 	assert(handler);
 
-	struct fd_entry* c = fd_entry_head;
-	struct fd_entry* end = NULL;
-	while(c)
-	{
-		if(c->next == NULL)
-		{ end = c; }
-
-		c = c->next;
-	}
+	struct fd_entry* const c = malloc(sizeof(struct fd_entry));
+	if(!c)
+	{ return NULL; }
 
-	c = malloc(sizeof(struct fd_entry));
 	c->fd = fd;
+	c->events = events;
 	c->handler = handler;
-	c->previous = end;
+	c->previous = ctx->fd_entry_tail;
 	c->next = NULL;
 
-	if(end)
-	{ end->next = c; }
+	if(ctx->fd_entry_tail)
+	{ ctx->fd_entry_tail->next = c; }
 	else
-	{ fd_entry_head = c; }
+	{ ctx->fd_entry_head = c; }
+	ctx->fd_entry_tail = c;
 
 	struct epoll_event ev;
   ev.events = events;
   ev.data.ptr = c;
-  epoll_ctl(epollfd, EPOLL_CTL_ADD, fd, &ev);
+  epoll_ctl(ctx->epollfd, EPOLL_CTL_ADD, fd, &ev);
 
 	return c;
 }
 
 
-static int can_sock = -1;
+static void fd_entry_modify(struct wlmio_ctx* const ctx, struct fd_entry* const entry, const uint32_t events)
+{
+	assert(entry);
+
+	if(entry->events == events)
+	{ return; }
+
+	struct epoll_event ev;
+	ev.events = events;
+	ev.data.ptr = entry;
+	epoll_ctl(ctx->epollfd, EPOLL_CTL_MOD, entry->fd, &ev);
+
+	entry->events = events;
+}
 
 
 static int32_t get_node_id(void)
@@ -143,264 +497,257 @@ static int32_t get_node_id(void)
 }
 
 
-struct task_entry
+static uint64_t monotonic_usec(void)
 {
-	uint32_t id;
-  struct fd_entry* timer;
-  void* param;
-	void (*callback)(int32_t r, void* uparam);
-  void* uparam;
-	struct task_entry* next;
-};
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000ULL;
+}
+
 
-static struct task_entry* head = NULL;
+static void timer_swap(struct wlmio_ctx* const ctx, const size_t a, const size_t b)
+{
+	struct timer_entry** const heap = ctx->timer_heap;
+	struct timer_entry* const t = heap[a];
+	heap[a] = heap[b];
+	heap[b] = t;
+	heap[a]->index = a;
+	heap[b]->index = b;
+}
 
 
-static void async_remove_entry(struct task_entry* const entry)
+static void timer_sift_up(struct wlmio_ctx* const ctx, size_t i)
 {
-  assert(entry);
-  
-  if(!head)
-  { return; }
+	while(i > 0)
+	{
+		const size_t parent = (i - 1) / 2;
+		if(ctx->timer_heap[parent]->deadline <= ctx->timer_heap[i]->deadline)
+		{ break; }
 
-  // close(entry->timer);
-	fd_entry_close(entry->timer);
+		timer_swap(ctx, i, parent);
+		i = parent;
+	}
+}
 
-  if(entry == head)
-  {
-    head = head->next;
-    free(entry);
-    return;
-  }
 
-  struct task_entry* p = head;
-  struct task_entry* c = head->next;
-  while(c)
-  {
-    if(c == entry)
-    {
-      p->next = c->next;
-      free(entry);
-      return;
-    }
+static void timer_sift_down(struct wlmio_ctx* const ctx, size_t i)
+{
+	struct timer_entry** const heap = ctx->timer_heap;
+	while(1)
+	{
+		const size_t left = 2 * i + 1;
+		const size_t right = left + 1;
+		size_t smallest = i;
 
-    p = c;
-    c = c->next;
-  }
+		if(left < ctx->timer_count && heap[left]->deadline < heap[smallest]->deadline)
+		{ smallest = left; }
+
+		if(right < ctx->timer_count && heap[right]->deadline < heap[smallest]->deadline)
+		{ smallest = right; }
+
+		if(smallest == i)
+		{ break; }
+
+		timer_swap(ctx, i, smallest);
+		i = smallest;
+	}
+}
+
+
+static void timer_arm(struct wlmio_ctx* const ctx, const uint64_t deadline)
+{
+	struct itimerspec it;
+	it.it_interval.tv_sec = 0;
+	it.it_interval.tv_nsec = 0;
+	it.it_value.tv_sec = deadline / 1000000ULL;
+	it.it_value.tv_nsec = (deadline % 1000000ULL) * 1000ULL;
+	timerfd_settime(ctx->timer_fd, TFD_TIMER_ABSTIME, &it, NULL);
+
+	ctx->timer_armed = deadline;
+}
+
+
+static void timer_init(struct timer_entry* const timer, void (* const handler)(struct wlmio_ctx*, struct timer_entry*))
+{
+	timer->deadline = 0;
+	timer->index = TIMER_UNSCHEDULED;
+	timer->handler = handler;
 }
 
 
-static void async_handler(struct fd_entry* entry)
+static int32_t timer_schedule(struct wlmio_ctx* const ctx, struct timer_entry* const timer, uint64_t deadline)
 {
-	struct task_entry* c = head;
-	while(c)
+	assert(timer);
+
+	// a zero deadline means the timerfd is disarmed
+	deadline = deadline ? deadline : 1;
+
+	if(timer->index == TIMER_UNSCHEDULED)
 	{
-		if(c->timer == entry)
-		{ break; }
+		if(ctx->timer_count == ctx->timer_capacity)
+		{
+			const size_t capacity = ctx->timer_capacity ? ctx->timer_capacity * 2 : 64;
+			struct timer_entry** const heap = realloc(ctx->timer_heap, capacity * sizeof(struct timer_entry*));
+			if(!heap)
+			{ return -ENOMEM; }
+
+			ctx->timer_heap = heap;
+			ctx->timer_capacity = capacity;
+		}
+
+		timer->deadline = deadline;
+		timer->index = ctx->timer_count;
+		ctx->timer_heap[ctx->timer_count] = timer;
+		ctx->timer_count += 1;
+		timer_sift_up(ctx, timer->index);
+	}
+	else
+	{
+		const uint64_t old = timer->deadline;
+		timer->deadline = deadline;
 
-		c = c->next;
+		if(deadline < old)
+		{ timer_sift_up(ctx, timer->index); }
+		else
+		{ timer_sift_down(ctx, timer->index); }
 	}
 
-	c->callback(-ETIMEDOUT, c->uparam);
-	async_remove_entry(c);
+	if(ctx->timer_armed == 0 || deadline < ctx->timer_armed)
+	{ timer_arm(ctx, deadline); }
+
+	return 0;
 }
 
 
-static int32_t async_add(const uint32_t id, const uint64_t timeout, void* const param, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+static void timer_cancel(struct wlmio_ctx* const ctx, struct timer_entry* const timer)
 {
-  assert(epollfd >= 0);
-	assert(callback);
+	assert(timer);
 
-	struct task_entry* const entry = malloc(sizeof(struct task_entry));
-  if(!entry)
-  { return -ENOMEM; }
+	const size_t i = timer->index;
+	if(i == TIMER_UNSCHEDULED)
+	{ return; }
 
-  // create and arm timeout timer
-  int timer = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
-  if(timer < 0)
-  {
-    free(entry);
-    return errno;
-  }
+	ctx->timer_count -= 1;
+	if(i != ctx->timer_count)
+	{
+		struct timer_entry* const moved = ctx->timer_heap[ctx->timer_count];
+		timer_swap(ctx, i, ctx->timer_count);
+		timer_sift_up(ctx, i);
+		timer_sift_down(ctx, moved->index);
+	}
 
-  struct itimerspec it;
-  it.it_interval.tv_nsec = 0;
-  it.it_interval.tv_sec = 0;
-  it.it_value.tv_sec = timeout / 1000000ULL;
-  it.it_value.tv_nsec = (timeout - it.it_value.tv_sec * 1000000ULL) * 1000ULL;
-  int32_t r = timerfd_settime(timer, 0, &it, NULL);
-  if(r < 0)
-  {
-    free(entry);
-    close(timer);
-    return errno;
-  }
+	timer->index = TIMER_UNSCHEDULED;
+}
 
-	// register timer with epoll
-  // struct epoll_event ev;
-  // ev.events = EPOLLIN;
-  // ev.data.ptr = entry;
-  // r = epoll_ctl(epollfd, EPOLL_CTL_ADD, timer, &ev);
-  // if(r < 0)
-  // {
-  //   free(entry);
-  //   close(timer);
-  //   return errno;
-  // }
-	struct fd_entry* fd_entry = fd_entry_add(timer, async_handler, EPOLLIN);
 
-  *entry = (struct task_entry)
-  {
-    .id = id,
-    .timer = fd_entry,
-    .param = param,
-    .callback = callback,
-    .uparam = uparam,
-    .next = NULL
-  };
-
-  // append entry
-  if(!head)
-  {
-    head = entry;
-    return 0;
-  }
+uint64_t wlmio_ctx_monotonic_usec(void)
+{
+	return monotonic_usec();
+}
+
 
-  struct task_entry* c = head;
-  while(c->next)
-  { c = c->next; }
+void wlmio_ctx_timer_init(struct timer_entry* const timer, void (* const handler)(struct wlmio_ctx*, struct timer_entry*))
+{
+	timer_init(timer, handler);
+}
 
-  c->next = entry;
 
-  return 0;
+int32_t wlmio_ctx_timer_schedule(struct wlmio_ctx* const ctx, struct timer_entry* const timer, const uint64_t deadline)
+{
+	return timer_schedule(ctx, timer, deadline);
 }
 
 
-static void async_tick(void)
+void wlmio_ctx_timer_cancel(struct wlmio_ctx* const ctx, struct timer_entry* const timer)
 {
-  struct task_entry* c = head;
-  while(c)
-  {
-    uint64_t e;
-    int r = read(c->timer->fd, &e, sizeof(e));
-    if(r > 0)
-    {
-      c->callback(-ETIMEDOUT, c->uparam);
-      struct task_entry* t = c;
-      c = c->next;
-      async_remove_entry(t);
-      continue;
-    }
-
-    c = c->next;
-  }
+	timer_cancel(ctx, timer);
 }
 
 
-static void async_complete(const uint32_t id, const int32_t r)
+static void timer_handler(struct wlmio_ctx* const ctx, struct fd_entry* const entry, const uint32_t events)
 {
-  struct task_entry* c = head;
-  while(c)
-  {
-    if(c->id == id)
-    {
-      c->callback(r, c->uparam);
-      async_remove_entry(c);
-      return;
-    }
+	uint64_t e;
+	read(entry->fd, &e, sizeof(e));
+	ctx->timer_armed = 0;
 
-    c = c->next;
-  }
+	const uint64_t now = monotonic_usec();
+	while(ctx->timer_count > 0 && ctx->timer_heap[0]->deadline <= now)
+	{
+		struct timer_entry* const t = ctx->timer_heap[0];
+		timer_cancel(ctx, t);
+		t->handler(ctx, t);
+	}
+
+	if(ctx->timer_count > 0 && (ctx->timer_armed == 0 || ctx->timer_heap[0]->deadline < ctx->timer_armed))
+	{ timer_arm(ctx, ctx->timer_heap[0]->deadline); }
 }
 
 
-static int32_t async_get_param(const uint32_t id, void** const param)
+static size_t task_slot(const uint32_t id)
 {
-  if(param == NULL)
-  { return -EINVAL; }
+	return (uint32_t)(id * 0x9E3779B1UL) >> (32U - TASK_TABLE_BITS);
+}
 
-  struct task_entry* c = head;
-  while(c)
-  {
-    if(c->id == id)
-    {
-      *param = c->param;
-      return 0;
-    }
 
-    c = c->next;
-  }
+static struct task_entry* task_find(struct wlmio_ctx* const ctx, const uint32_t id)
+{
+	struct task_entry** const table = ctx->task_table;
+	for(size_t i = task_slot(id); table[i]; i = (i + 1U) & (TASK_TABLE_SIZE - 1U))
+	{
+		if(table[i]->id == id)
+		{ return table[i]; }
+	}
 
-  return -ENOENT;
+	return NULL;
 }
 
 
-int32_t wlmio_shutdown(void)
+static int32_t task_insert(struct wlmio_ctx* const ctx, struct task_entry* const entry)
 {
-	close(can_sock);
-	can_sock = -1;
+	if(ctx->task_count >= TASK_TABLE_MAX_LOAD)
+	{ return -EBUSY; }
 
-	close(epollfd);
-	epollfd = -1;
+	size_t i = task_slot(entry->id);
+	while(ctx->task_table[i])
+	{ i = (i + 1U) & (TASK_TABLE_SIZE - 1U); }
+
+	ctx->task_table[i] = entry;
+	ctx->task_count += 1;
 
 	return 0;
 }
 
 
-static int uavcan_send(void)
+static void task_remove(struct wlmio_ctx* const ctx, const struct task_entry* const entry)
 {
+	struct task_entry** const table = ctx->task_table;
+
+	size_t i = task_slot(entry->id);
+	while(table[i] != entry)
+	{
+		assert(table[i]);
+		i = (i + 1U) & (TASK_TABLE_SIZE - 1U);
+	}
+
+	// backward shift deletion
+	size_t j = i;
 	while(1)
 	{
-		const CanardFrame* const txf = canardTxPeek(&canard);
-		if(txf == NULL) { break; }
-			
-		struct canfd_frame frame;
-		frame.can_id = txf->extended_can_id | 0x80000000UL;
-		frame.len = txf->payload_size;
-		memcpy(frame.data, txf->payload, txf->payload_size);
-			
-		// write(can_sock, &frame, sizeof(struct canfd_frame));
-		int r = send(can_sock, &frame, sizeof(struct canfd_frame), MSG_DONTWAIT);
-
-		// if(r < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
-		if(r < 0)
+		j = (j + 1U) & (TASK_TABLE_SIZE - 1U);
+		if(!table[j])
 		{ break; }
 
-		// free frame after transmission
-		canardTxPop(&canard);
-		canard.memory_free(&canard, (void*)txf);
-	}
-	
-	return 0;
-}
+		// move the entry at j into the hole unless its home slot lies cyclically in (i, j]
+		const size_t k = task_slot(table[j]->id);
+		if(((j - k) & (TASK_TABLE_SIZE - 1U)) < ((j - i) & (TASK_TABLE_SIZE - 1U)))
+		{ continue; }
 
+		table[i] = table[j];
+		i = j;
+	}
 
-static int receive_transfer(CanardTransfer* const tfr)
-{
-	assert(tfr != NULL);
-	
-	struct canfd_frame frame;
-	int r = recv(can_sock, &frame, sizeof(struct canfd_frame), MSG_DONTWAIT);
-	
-	if(r < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
-	{ return 0; }
-	else if(r < 0)
-	{ return -1; }
-	
-	struct timeval tv;
-	ioctl(can_sock, SIOCGSTAMP, &tv);
-	
-	CanardFrame rxf;
-	rxf.timestamp_usec = (tv.tv_sec * 1000000ULL) + tv.tv_usec;
-	rxf.extended_can_id = frame.can_id & 0x1FFFFFFFUL;
-	rxf.payload_size = frame.len;
-	rxf.payload = frame.data;
-	
-	r = canardRxAccept(&canard, &rxf, 0, tfr);
-	if(r <= 0)
-	{ return 0; }
-	
-	return 1;
+	table[i] = NULL;
+	ctx->task_count -= 1;
 }
 
 
@@ -413,59 +760,442 @@ static uint32_t make_rsp_specifier(const CanardTransfer* const tfr)
 }
 
 
-static void get_node_info_response_handler(const CanardTransfer* const tfr)
+// called before a request callback runs so the callback cannot cancel the request a second time
+static void task_invalidate(struct wlmio_ctx* const ctx, const struct task_entry* const entry)
 {
-	const uint32_t id = make_rsp_specifier(tfr);
+	ctx->task_generations[slab_index(&ctx->slab, entry)] += 1;
+}
 
-	struct wlmio_node_info* node_info;
-	int32_t r = async_get_param(id, (void**)&node_info);
-	if(r < 0)
-	{ goto exit; }
 
-	memset(node_info, 0, sizeof(struct wlmio_node_info));
+static void task_free(struct wlmio_ctx* const ctx, struct task_entry* const entry)
+{
+	task_invalidate(ctx, entry);
+	slab_free(&ctx->slab, entry);
+}
 
-	if(tfr->payload_size > 0)
-	{
-		size_t payload_offset = 0;
 
-		node_info->protocol_version.major = canardDSDLGetU8(tfr->payload, tfr->payload_size, payload_offset << 3, 8);
-		payload_offset += 1;
+static int64_t task_handle(const struct wlmio_ctx* const ctx, const struct task_entry* const entry)
+{
+	const size_t i = slab_index(&ctx->slab, entry);
+	return ((int64_t)ctx->task_generations[i] << 16) | i;
+}
 
-		node_info->protocol_version.minor = canardDSDLGetU8(tfr->payload, tfr->payload_size, payload_offset << 3, 8);
-		payload_offset += 1;
 
-		node_info->hardware_version.major = canardDSDLGetU8(tfr->payload, tfr->payload_size, payload_offset << 3, 8);
-		payload_offset += 1;
+static struct task_entry* task_from_handle(const struct wlmio_ctx* const ctx, const int64_t handle)
+{
+	if(handle < 0)
+	{ return NULL; }
 
-		node_info->hardware_version.minor = canardDSDLGetU8(tfr->payload, tfr->payload_size, payload_offset << 3, 8);
-		payload_offset += 1;
+	const size_t i = handle & 0xFFFF;
+	if(i >= WLMIO_REQUEST_SLAB_CAPACITY || ctx->task_generations[i] != (uint16_t)(handle >> 16))
+	{ return NULL; }
 
-		node_info->software_version.major = canardDSDLGetU8(tfr->payload, tfr->payload_size, payload_offset << 3, 8);
-		payload_offset += 1;
+	return slab_object(&ctx->slab, i);
+}
 
-		node_info->software_version.minor = canardDSDLGetU8(tfr->payload, tfr->payload_size, payload_offset << 3, 8);
-		payload_offset += 1;
 
-		node_info->software_vcs_revision_id = canardDSDLGetU64(tfr->payload, tfr->payload_size, payload_offset << 3, 64);
-		payload_offset += 8;
+static uint_fast16_t request_limit(const struct wlmio_ctx* const ctx, const uint_fast8_t node_id)
+{
+	return ctx->node_limits[node_id] ? ctx->node_limits[node_id] : WLMIO_NODE_REQUEST_LIMIT;
+}
 
-		if(tfr->payload_size > payload_offset)
-		{
-			size_t bytes = tfr->payload_size - payload_offset;
-			bytes = bytes > 16 ? 16 : bytes;
-			memcpy(node_info->unique_id, tfr->payload + payload_offset, bytes);
-		}
-		payload_offset += 16;
 
-		const uint8_t name_len = canardDSDLGetU8(tfr->payload, tfr->payload_size, payload_offset << 3, 8);
-		payload_offset += 1;
-		if(name_len > 50)
-		{
-			r = -EPROTO;
-			goto exit;
-		}
+static bool request_can_issue(const struct wlmio_ctx* const ctx, const struct task_entry* const entry)
+{
+	return
+	ctx->node_inflight[entry->node_id] < request_limit(ctx, entry->node_id) &&
+	ctx->tfr_busy[entry->service][entry->node_id] != UINT32_MAX;
+}
 
-		if(tfr->payload_size > payload_offset)
+
+// assign a free transfer ID, register the pending response and queue the request for transmission
+static int32_t request_issue(struct wlmio_ctx* const ctx, struct task_entry* const entry, const void* const payload, const size_t payload_size)
+{
+	uint32_t* const busy = &ctx->tfr_busy[entry->service][entry->node_id];
+	uint8_t* const next = &ctx->tfr_next[entry->service][entry->node_id];
+
+	assert(*busy != UINT32_MAX);
+
+	uint8_t transfer_id = *next;
+	while(*busy & (UINT32_C(1) << transfer_id))
+	{ transfer_id = (transfer_id + 1U) & 0x1FU; }
+
+	// libcanard carries the transfer timestamp into each frame as its transmission deadline
+	const CanardTransfer tfr =
+	{
+		.timestamp_usec = entry->tx_deadline,
+		.priority = entry->priority,
+		.transfer_kind = CanardTransferKindRequest,
+		.port_id = request_port_ids[entry->service],
+		.remote_node_id = entry->node_id,
+		.transfer_id = transfer_id,
+		.payload_size = payload_size,
+		.payload = payload
+	};
+
+	entry->id = make_rsp_specifier(&tfr);
+	entry->transfer_id = transfer_id;
+
+	int32_t r = task_insert(ctx, entry);
+	if(r < 0)
+	{ return r; }
+
+	r = canardTxPush(&ctx->canard, &tfr);
+	if(r < 0)
+	{
+		task_remove(ctx, entry);
+		return r == -CANARD_ERROR_OUT_OF_MEMORY ? -ENOMEM : -EINVAL;
+	}
+
+	*busy |= UINT32_C(1) << transfer_id;
+	*next = (transfer_id + 1U) & 0x1FU;
+	ctx->node_inflight[entry->node_id] += 1;
+
+	return 0;
+}
+
+
+// issue queued requests of a node for as long as it has transfer IDs and concurrency slots free
+static void request_pump(struct wlmio_ctx* const ctx, const uint_fast8_t node_id)
+{
+	struct task_entry* entry;
+	while((entry = ctx->node_queue_head[node_id]) && request_can_issue(ctx, entry))
+	{
+		ctx->node_queue_head[node_id] = entry->next;
+		if(!entry->next)
+		{ ctx->node_queue_tail[node_id] = &ctx->node_queue_head[node_id]; }
+		entry->queued = false;
+
+		// the request waited in the queue past its transmission deadline
+		int32_t r;
+		if(entry->tx_deadline != 0 && entry->tx_deadline < monotonic_usec())
+		{
+			ctx->tx_expired += 1;
+			r = -ETIMEDOUT;
+		}
+		else
+		{ r = request_issue(ctx, entry, entry->payload, entry->payload_size); }
+
+		pool_free(&ctx->pool, entry->payload);
+		entry->payload = NULL;
+
+		if(r < 0)
+		{
+			timer_cancel(ctx, &entry->timer);
+			task_invalidate(ctx, entry);
+			entry->callback(r, entry->uparam);
+			task_free(ctx, entry);
+		}
+	}
+}
+
+
+static void async_remove_entry(struct wlmio_ctx* const ctx, struct task_entry* const entry)
+{
+  assert(entry);
+
+	const uint_fast8_t node_id = entry->node_id;
+
+	timer_cancel(ctx, &entry->timer);
+
+	if(entry->queued)
+	{
+		struct task_entry** p = &ctx->node_queue_head[node_id];
+		while(*p != entry)
+		{ p = &(*p)->next; }
+
+		*p = entry->next;
+		if(!entry->next)
+		{ ctx->node_queue_tail[node_id] = p; }
+
+		pool_free(&ctx->pool, entry->payload);
+	}
+	else
+	{
+		task_remove(ctx, entry);
+		ctx->tfr_busy[entry->service][node_id] &= ~(UINT32_C(1) << entry->transfer_id);
+		ctx->node_inflight[node_id] -= 1;
+	}
+
+	task_free(ctx, entry);
+
+	// a transfer ID or concurrency slot may have come free
+	request_pump(ctx, node_id);
+}
+
+
+static void async_handler(struct wlmio_ctx* const ctx, struct timer_entry* const timer)
+{
+	struct task_entry* const c = (struct task_entry*)((char*)timer - offsetof(struct task_entry, timer));
+
+	task_invalidate(ctx, c);
+	c->callback(-ETIMEDOUT, c->uparam);
+	async_remove_entry(ctx, c);
+}
+
+
+static void read_waiter_cancel(struct wlmio_ctx* ctx, struct task_entry* waiter, int32_t r);
+
+
+static int32_t async_cancel(struct wlmio_ctx* const ctx, const int64_t handle, const int32_t r)
+{
+	struct task_entry* const c = task_from_handle(ctx, handle);
+	if(!c)
+	{ return -ENOENT; }
+
+	if(c->flight)
+	{
+		read_waiter_cancel(ctx, c, r);
+		return 0;
+	}
+
+	task_invalidate(ctx, c);
+	c->callback(r, c->uparam);
+	async_remove_entry(ctx, c);
+
+	return 0;
+}
+
+
+// Fail every request of a node, queued ones first so that failing the in-flight ones does not
+// issue them. Handles are collected up front because the callbacks may issue or cancel requests.
+static size_t async_cancel_node(struct wlmio_ctx* const ctx, const uint_fast8_t node_id, const int32_t r)
+{
+	int64_t handles[WLMIO_REQUEST_SLAB_CAPACITY];
+	size_t n = 0;
+
+	for(const struct task_entry* c = ctx->node_queue_head[node_id]; c; c = c->next)
+	{
+		handles[n] = task_handle(ctx, c);
+		n += 1;
+	}
+
+	for(size_t i = 0; i < TASK_TABLE_SIZE && n < WLMIO_REQUEST_SLAB_CAPACITY; i += 1)
+	{
+		const struct task_entry* const c = ctx->task_table[i];
+		if(c && c->node_id == node_id)
+		{
+			handles[n] = task_handle(ctx, c);
+			n += 1;
+		}
+	}
+
+	size_t cancelled = 0;
+	for(size_t i = 0; i < n; i += 1)
+	{
+		if(async_cancel(ctx, handles[i], r) == 0)
+		{ cancelled += 1; }
+	}
+
+	return cancelled;
+}
+
+
+static void async_complete(struct wlmio_ctx* const ctx, const uint32_t id, const int32_t r)
+{
+	struct task_entry* const c = task_find(ctx, id);
+	if(!c)
+	{ return; }
+
+	task_invalidate(ctx, c);
+	c->callback(r, c->uparam);
+	async_remove_entry(ctx, c);
+}
+
+
+static int32_t async_get_param(struct wlmio_ctx* const ctx, const uint32_t id, void** const param)
+{
+  if(param == NULL)
+  { return -EINVAL; }
+
+	const struct task_entry* const c = task_find(ctx, id);
+	if(!c)
+	{ return -ENOENT; }
+
+	*param = c->param;
+	return 0;
+}
+
+
+void wlmio_ctx_close(struct wlmio_ctx* const ctx)
+{
+	if(!ctx)
+	{ return; }
+
+	while(ctx->fd_entry_head)
+	{ fd_entry_close(ctx, ctx->fd_entry_head); }
+
+	// pending requests are dropped without a callback, their contexts go away with the slab
+	free(ctx->timer_heap);
+
+	if(ctx->epollfd >= 0)
+	{ close(ctx->epollfd); }
+
+	mpsc_deinit(&ctx->submit_queue);
+	schema_cache_deinit(&ctx->schema_cache);
+	pool_deinit(&ctx->pool);
+	slab_deinit(&ctx->slab);
+	slab_deinit(&ctx->group_slab);
+
+	free(ctx);
+}
+
+
+int32_t wlmio_shutdown(void)
+{
+	wlmio_ctx_close(default_ctx);
+	default_ctx = NULL;
+
+	return 0;
+}
+
+
+static int uavcan_send(struct wlmio_ctx* const ctx)
+{
+	if(ctx->can_sock < 0)
+	{ return -1; }
+
+	const uint64_t now = monotonic_usec();
+
+	// drop staged frames that went stale while the socket was full
+	size_t kept = 0;
+	for(size_t i = 0; i < ctx->can_tx_count; i += 1)
+	{
+		if(ctx->can_tx_deadlines[i] != 0 && ctx->can_tx_deadlines[i] < now)
+		{
+			ctx->tx_expired += 1;
+			continue;
+		}
+
+		if(kept != i)
+		{
+			ctx->can_tx_frames[kept] = ctx->can_tx_frames[i];
+			ctx->can_tx_deadlines[kept] = ctx->can_tx_deadlines[i];
+		}
+		kept += 1;
+	}
+	ctx->can_tx_count = kept;
+
+	while(1)
+	{
+		// top up the staging buffer, libcanard generates each frame straight into its slot
+		while(ctx->can_tx_count < WLMIO_CAN_TX_BATCH_SIZE)
+		{
+			struct canfd_frame* const frame = &ctx->can_tx_frames[ctx->can_tx_count];
+			CanardFrame txf;
+			if(canardTxEmit(&ctx->canard, &txf, frame->data) <= 0)
+			{ break; }
+
+			if(txf.timestamp_usec != 0 && txf.timestamp_usec < now)
+			{
+				ctx->tx_expired += 1;
+				continue;
+			}
+
+			frame->can_id = txf.extended_can_id | CAN_EFF_FLAG;
+			frame->len = txf.payload_size;
+			ctx->can_tx_deadlines[ctx->can_tx_count] = txf.timestamp_usec;
+			ctx->can_tx_count += 1;
+		}
+
+		if(ctx->can_tx_count == 0)
+		{ break; }
+
+		const int r = sendmmsg(ctx->can_sock, ctx->can_tx_msgs, ctx->can_tx_count, MSG_DONTWAIT);
+		if(r > 0)
+		{
+			// a short write is followed by another call, which reports why the socket stopped
+			const size_t sent = r;
+			ctx->can_tx_count -= sent;
+			memmove(&ctx->can_tx_frames[0], &ctx->can_tx_frames[sent], ctx->can_tx_count * sizeof(struct canfd_frame));
+			memmove(&ctx->can_tx_deadlines[0], &ctx->can_tx_deadlines[sent], ctx->can_tx_count * sizeof(uint64_t));
+			continue;
+		}
+
+		if(r < 0 && errno == ENOBUFS)
+		{
+			// the interface queue is full while the socket still polls writable, EPOLLOUT would fire
+			// again right away
+			fd_entry_modify(ctx, ctx->can_entry, EPOLLIN);
+			if(ctx->can_tx_retry.index == TIMER_UNSCHEDULED)
+			{ timer_schedule(ctx, &ctx->can_tx_retry, monotonic_usec() + WLMIO_CAN_TX_RETRY_INTERVAL); }
+			return 0;
+		}
+
+		if(r < 0 && errno != EAGAIN && errno != EWOULDBLOCK)
+		{ return -1; }
+
+		// socket is full, keep the frames staged and wait for room
+		fd_entry_modify(ctx, ctx->can_entry, EPOLLIN | EPOLLOUT);
+		return 0;
+	}
+
+	fd_entry_modify(ctx, ctx->can_entry, EPOLLIN);
+	timer_cancel(ctx, &ctx->can_tx_retry);
+
+	return 0;
+}
+
+
+static void can_tx_retry_handler(struct wlmio_ctx* const ctx, struct timer_entry* const timer)
+{
+	uavcan_send(ctx);
+}
+
+
+static void get_node_info_response_handler(struct wlmio_ctx* const ctx, const CanardTransfer* const tfr)
+{
+	const uint32_t id = make_rsp_specifier(tfr);
+
+	struct wlmio_node_info* node_info;
+	int32_t r = async_get_param(ctx, id, (void**)&node_info);
+	if(r < 0)
+	{ goto exit; }
+
+	memset(node_info, 0, sizeof(struct wlmio_node_info));
+
+	if(tfr->payload_size > 0)
+	{
+		size_t payload_offset = 0;
+
+		node_info->protocol_version.major = canardDSDLGetU8(tfr->payload, tfr->payload_size, payload_offset << 3, 8);
+		payload_offset += 1;
+
+		node_info->protocol_version.minor = canardDSDLGetU8(tfr->payload, tfr->payload_size, payload_offset << 3, 8);
+		payload_offset += 1;
+
+		node_info->hardware_version.major = canardDSDLGetU8(tfr->payload, tfr->payload_size, payload_offset << 3, 8);
+		payload_offset += 1;
+
+		node_info->hardware_version.minor = canardDSDLGetU8(tfr->payload, tfr->payload_size, payload_offset << 3, 8);
+		payload_offset += 1;
+
+		node_info->software_version.major = canardDSDLGetU8(tfr->payload, tfr->payload_size, payload_offset << 3, 8);
+		payload_offset += 1;
+
+		node_info->software_version.minor = canardDSDLGetU8(tfr->payload, tfr->payload_size, payload_offset << 3, 8);
+		payload_offset += 1;
+
+		node_info->software_vcs_revision_id = canardDSDLGetU64(tfr->payload, tfr->payload_size, payload_offset << 3, 64);
+		payload_offset += 8;
+
+		if(tfr->payload_size > payload_offset)
+		{
+			size_t bytes = tfr->payload_size - payload_offset;
+			bytes = bytes > 16 ? 16 : bytes;
+			memcpy(node_info->unique_id, tfr->payload + payload_offset, bytes);
+		}
+		payload_offset += 16;
+
+		const uint8_t name_len = canardDSDLGetU8(tfr->payload, tfr->payload_size, payload_offset << 3, 8);
+		payload_offset += 1;
+		if(name_len > 50)
+		{
+			r = -EPROTO;
+			goto exit;
+		}
+
+		if(tfr->payload_size > payload_offset)
 		{
 			size_t bytes = tfr->payload_size - payload_offset;
 			bytes = bytes > name_len ? name_len : bytes;
@@ -510,16 +1240,16 @@ static void get_node_info_response_handler(const CanardTransfer* const tfr)
 	r = 0;
 
 exit:
-	async_complete(id, r);
+	async_complete(ctx, id, r);
 }
 
 
-static void register_list_response_handler(const CanardTransfer* const tfr)
+static void register_list_response_handler(struct wlmio_ctx* const ctx, const CanardTransfer* const tfr)
 {
 	const uint32_t id = make_rsp_specifier(tfr);
 
 	char* name;
-	int32_t r = async_get_param(id, (void**)&name);
+	int32_t r = async_get_param(ctx, id, (void**)&name);
 	if(r < 0) { return; }
 
 	uint8_t name_len = 0;
@@ -534,7 +1264,7 @@ static void register_list_response_handler(const CanardTransfer* const tfr)
 		{ memcpy(name, tfr->payload + 1, tfr->payload_size - 1); }
 	}
 
-	async_complete(id, 0);
+	async_complete(ctx, id, 0);
 }
 
 
@@ -592,12 +1322,12 @@ static const uint8_t register_value_bit_width[15] = {0U, 8U, 8U, 1U, 64U, 32U, 1
 static const uint8_t register_value_length_width[15] = {0U, 2U, 2U, 2U, 1U, 1U, 1U, 2U, 1U, 1U, 1U, 2U, 1U, 1U, 1U};
 
 
-static void register_access_response_handler(const CanardTransfer* const tfr)
+static void register_access_response_handler(struct wlmio_ctx* const ctx, const CanardTransfer* const tfr)
 {
 	const uint32_t id = make_rsp_specifier(tfr);
 
 	struct wlmio_register_access* uregr;
-	int32_t r = async_get_param(id, (void**)&uregr);
+	int32_t r = async_get_param(ctx, id, (void**)&uregr);
 	if(r < 0) { return; }
 
 	struct wlmio_register_access regr =
@@ -637,11 +1367,11 @@ exit1:
 	if(uregr)
 	{ *uregr = regr; }
 
-	async_complete(id, r);
+	async_complete(ctx, id, r);
 }
 
 
-static void execute_command_response_handler(const CanardTransfer* const tfr)
+static void execute_command_response_handler(struct wlmio_ctx* const ctx, const CanardTransfer* const tfr)
 {
 	const uint32_t id = make_rsp_specifier(tfr);
 	
@@ -651,27 +1381,32 @@ static void execute_command_response_handler(const CanardTransfer* const tfr)
 		status = canardDSDLGetU8(tfr->payload, tfr->payload_size, 0, 8);
 	}
 	
-	async_complete(id, status);
+	async_complete(ctx, id, status);
+}
+
+
+
+
+static uint64_t heartbeat_deadline(const struct wlmio_ctx* const ctx, const uint_fast8_t node_id)
+{
+	const uint64_t t = ctx->heartbeat_timeouts[node_id] ? ctx->heartbeat_timeouts[node_id] : WLMIO_HEARTBEAT_TIMEOUT;
+	return ctx->heartbeat_last_seen[node_id] + t;
 }
 
 
-static void heartbeat_timeout_handler(struct fd_entry* const entry)
+static void heartbeat_timeout_handler(struct wlmio_ctx* const ctx, struct timer_entry* const timer)
 {
-	uint_fast8_t node_id;
-	struct wlmio_status* node;
-	for(uint_fast8_t i = 0; i < CANARD_NODE_ID_MAX; i += 1)
+	const uint_fast8_t node_id = timer - ctx->heartbeat_timers;
+	struct wlmio_status* const node = &ctx->nodes[node_id];
+
+	// heard from since the timer was scheduled
+	const uint64_t deadline = heartbeat_deadline(ctx, node_id);
+	if(deadline > monotonic_usec())
 	{
-		if(timers[i] == entry->fd)
-		{
-			node_id = i;
-			node = &nodes[node_id];
-			break;
-		}
+		timer_schedule(ctx, timer, deadline);
+		return;
 	}
 
-	fd_entry_close(entry);
-	timers[node_id] = -1;
-
 	const struct wlmio_status old_status = *node;
 	*node = (struct wlmio_status)
 	{
@@ -681,12 +1416,17 @@ static void heartbeat_timeout_handler(struct fd_entry* const entry)
 		.vendor_status = 0
 	};
 
-	if(user_callback)
-	{ user_callback(node_id, &old_status, node); }
+	schema_cache_invalidate(&ctx->schema_cache, node_id);
+
+	if(ctx->offline_fails_requests)
+	{ async_cancel_node(ctx, node_id, -EHOSTDOWN); }
+
+	if(ctx->user_callback)
+	{ ctx->user_callback(node_id, &old_status, node); }
 }
 
 
-static void heartbeat_handler(const CanardTransfer* const tfr)
+static void heartbeat_handler(struct wlmio_ctx* const ctx, const CanardTransfer* const tfr)
 {
   assert(tfr);
 
@@ -697,7 +1437,7 @@ static void heartbeat_handler(const CanardTransfer* const tfr)
 
   assert(node_id <= CANARD_NODE_ID_MAX);
 
-  struct wlmio_status* const status = &nodes[node_id];
+  struct wlmio_status* const status = &ctx->nodes[node_id];
   const struct wlmio_status old_status = *status;
 
   size_t payload_offset = 0;
@@ -714,107 +1454,135 @@ static void heartbeat_handler(const CanardTransfer* const tfr)
   status->vendor_status = canardDSDLGetU8(tfr->payload, tfr->payload_size, payload_offset, 8);
   payload_offset += 8;
 
-  // stop timeout timer if node is going offline
-  if(status->mode == WLMIO_MODE_OFFLINE && timers[node_id] >= 0)
-  {
-		fd_entry_close(fd_entry_find(timers[node_id]));
-    timers[node_id] = -1;
-  }
-  
-  // create timeout timer if node is coming online
-  if(status->mode != WLMIO_MODE_OFFLINE && timers[node_id] < 0)
-  {
-    timers[node_id] = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
-
-    // register timer with epoll
-    // struct epoll_event ev;
-    // ev.events = EPOLLIN;
-    // ev.data.ptr = status;
-    // epoll_ctl(epollfd, EPOLL_CTL_ADD, timers[node_id], &ev);
-		fd_entry_add(timers[node_id], heartbeat_timeout_handler, EPOLLIN);
-  }
+  // A node that restarted may have been replaced or updated. Nodes start out offline, so the first
+  // heartbeat of a node is not a restart; a node that timed out was invalidated by its timer.
+  if(old_status.mode != WLMIO_MODE_OFFLINE && (status->uptime < old_status.uptime || status->mode == WLMIO_MODE_OFFLINE))
+  { schema_cache_invalidate(&ctx->schema_cache, node_id); }
 
-  // reset timeout timer if node is still online
-  if(status->mode != WLMIO_MODE_OFFLINE && timers[node_id] >= 0)
-  {
-    struct itimerspec it;
-    it.it_interval.tv_nsec = 0;
-    it.it_interval.tv_sec = 0;
-    it.it_value.tv_sec = 3U;
-    it.it_value.tv_nsec = 0U;
-    timerfd_settime(timers[node_id], 0, &it, NULL);
-  }
+  // stop timeout timer if node is going offline, otherwise start it unless it is already running
+  ctx->heartbeat_last_seen[node_id] = ctx->rx_time_usec;
+  if(status->mode == WLMIO_MODE_OFFLINE)
+  { timer_cancel(ctx, &ctx->heartbeat_timers[node_id]); }
+  else if(ctx->heartbeat_timers[node_id].index == TIMER_UNSCHEDULED)
+  { timer_schedule(ctx, &ctx->heartbeat_timers[node_id], heartbeat_deadline(ctx, node_id)); }
 
-  if(user_callback)
-  { user_callback(node_id, &old_status, status); }
+  if(ctx->user_callback)
+  { ctx->user_callback(node_id, &old_status, status); }
 }
 
 
-static void can_socket_handler(struct fd_entry* const entry)
+static void can_frame_handler(struct wlmio_ctx* const ctx, const struct canfd_frame* const frame, const uint64_t timestamp_usec)
 {
-	struct canfd_frame frame;
-	int32_t r = read(entry->fd, &frame, sizeof(struct canfd_frame));
-	if(r < 0)
-	{ return; }
-	
-	struct timeval tv;
-	ioctl(entry->fd, SIOCGSTAMP, &tv);
-	
 	CanardFrame rxf;
-	rxf.timestamp_usec = (tv.tv_sec * 1000000ULL) + tv.tv_usec;
-	rxf.extended_can_id = frame.can_id & 0x1FFFFFFFUL;
-	rxf.payload_size = frame.len;
-	rxf.payload = frame.data;
-	
+	rxf.timestamp_usec = timestamp_usec;
+	rxf.extended_can_id = frame->can_id & 0x1FFFFFFFUL;
+	rxf.payload_size = frame->len;
+	rxf.payload = frame->data;
+
 	CanardTransfer tfr;
-	r = canardRxAccept(&canard, &rxf, 0, &tfr);
+	int32_t r = canardRxAccept(&ctx->canard, &rxf, 0, &tfr);
 	if(r <= 0)
 	{ return; }
-	
+
 	if(tfr.port_id == 7509 && tfr.transfer_kind == CanardTransferKindMessage)
-	{ heartbeat_handler(&tfr); }
-	
+	{ heartbeat_handler(ctx, &tfr); }
+
 	else if(tfr.port_id == 430 && tfr.transfer_kind == CanardTransferKindResponse)
-	{ get_node_info_response_handler(&tfr); }
+	{ get_node_info_response_handler(ctx, &tfr); }
 
 	else if(tfr.port_id == 385 && tfr.transfer_kind == CanardTransferKindResponse)
-	{ register_list_response_handler(&tfr); }
+	{ register_list_response_handler(ctx, &tfr); }
 
 	else if(tfr.port_id == 384 && tfr.transfer_kind == CanardTransferKindResponse)
-	{ register_access_response_handler(&tfr); }
+	{ register_access_response_handler(ctx, &tfr); }
 
 	else if(tfr.port_id == 435 && tfr.transfer_kind == CanardTransferKindResponse)
-	{ execute_command_response_handler(&tfr); }
-	
-	// free transfer payload after processing if there is one
-	if(tfr.payload_size > 0 && tfr.payload != NULL) { free((void*)tfr.payload); }
+	{ execute_command_response_handler(ctx, &tfr); }
+
+	// single-frame payloads point into the frame buffer, only reassembled payloads were allocated
+	const uint8_t* const payload = tfr.payload;
+	if(payload != NULL && (payload < frame->data || payload >= frame->data + CANFD_MAX_DLEN))
+	{ ctx->canard.memory_free(&ctx->canard, (void*)payload); }
 }
 
 
-static int can_socket_init(void)
+static uint64_t can_rx_timestamp(struct msghdr* const msg)
 {
-	struct sockaddr_can addr;
-	struct ifreq ifr;
-	
-	int s = socket(PF_CAN, SOCK_RAW | SOCK_CLOEXEC, CAN_RAW);
-	if(s < 0)
-	{ return -1; }
-	
-	strcpy(ifr.ifr_name, "can0");
-	int r = ioctl(s, SIOCGIFINDEX, &ifr);
-	if(r < 0)
-	{ return -1; }
-	
-	addr.can_family = AF_CAN;
-	addr.can_ifindex = ifr.ifr_ifindex;
-	
-	r = bind(s, (struct sockaddr*)&addr, sizeof(addr));
-	if(r < 0)
+	for(struct cmsghdr* c = CMSG_FIRSTHDR(msg); c; c = CMSG_NXTHDR(msg, c))
+	{
+		if(c->cmsg_level != SOL_SOCKET)
+		{ continue; }
+
+		if(c->cmsg_type == SCM_TIMESTAMPING)
+		{
+			// ts[0] is the software timestamp, ts[2] the raw hardware timestamp if the driver provides one
+			struct timespec ts[3];
+			memcpy(ts, CMSG_DATA(c), sizeof(ts));
+
+			const struct timespec* const t = (ts[2].tv_sec || ts[2].tv_nsec) ? &ts[2] : &ts[0];
+			return (t->tv_sec * 1000000ULL) + (t->tv_nsec / 1000ULL);
+		}
+
+		if(c->cmsg_type == SCM_TIMESTAMP)
+		{
+			struct timeval tv;
+			memcpy(&tv, CMSG_DATA(c), sizeof(tv));
+			return (tv.tv_sec * 1000000ULL) + tv.tv_usec;
+		}
+	}
+
+	return 0;
+}
+
+
+static void can_socket_handler(struct wlmio_ctx* const ctx, struct fd_entry* const entry, const uint32_t events)
+{
+	if(events & EPOLLOUT)
+	{ uavcan_send(ctx); }
+
+	if(!(events & EPOLLIN))
+	{ return; }
+
+	// drain the socket until it would block
+	for(uint_fast16_t received = 0; received < WLMIO_CAN_RX_BUDGET; )
+	{
+		for(uint_fast8_t i = 0; i < WLMIO_CAN_RX_BATCH_SIZE; i += 1)
+		{ ctx->can_rx_msgs[i].msg_hdr.msg_controllen = CAN_RX_CONTROL_SIZE; }
+
+		const int32_t n = recvmmsg(entry->fd, ctx->can_rx_msgs, WLMIO_CAN_RX_BATCH_SIZE, MSG_DONTWAIT, NULL);
+		if(n <= 0)
+		{ break; }
+
+		// frame timestamps may come from the CAN controller clock, liveness needs the monotonic clock
+		ctx->rx_time_usec = monotonic_usec();
+
+		for(int32_t i = 0; i < n; i += 1)
+		{
+			if(ctx->can_rx_msgs[i].msg_len < CAN_MTU)
+			{ continue; }
+
+			can_frame_handler(ctx, &ctx->can_rx_frames[i], can_rx_timestamp(&ctx->can_rx_msgs[i].msg_hdr));
+		}
+
+		received += n;
+
+		// a partial batch means the socket is empty
+		if(n < WLMIO_CAN_RX_BATCH_SIZE)
+		{ break; }
+	}
+}
+
+
+static int can_socket_init(struct wlmio_ctx* const ctx, const char* const ifname)
+{
+	struct sockaddr_can addr;
+	struct ifreq ifr;
+
+	if(strlen(ifname) >= IFNAMSIZ)
 	{ return -1; }
-	
-	int canfd = 1;
-	r = setsockopt(s, SOL_CAN_RAW, CAN_RAW_FD_FRAMES, &canfd, sizeof(int));
-	if(r < 0)
+
+	int s = socket(PF_CAN, SOCK_RAW | SOCK_CLOEXEC, CAN_RAW);
+	if(s < 0)
 	{ return -1; }
 
 	// register CAN socket with epoll
@@ -824,330 +1592,1265 @@ static int can_socket_init(void)
   // r = epoll_ctl(epollfd, EPOLL_CTL_ADD, s, &ev);
   // if(r < 0)
   // { return -1; }
-	fd_entry_add(s, can_socket_handler, EPOLLIN);
-	
+	ctx->can_entry = fd_entry_add(ctx, s, can_socket_handler, EPOLLIN);
+	if(!ctx->can_entry)
+	{
+		close(s);
+		return -1;
+	}
+
+	strcpy(ifr.ifr_name, ifname);
+	int r = ioctl(s, SIOCGIFINDEX, &ifr);
+	if(r < 0)
+	{ return -1; }
+
+	addr.can_family = AF_CAN;
+	addr.can_ifindex = ifr.ifr_ifindex;
+
+	r = bind(s, (struct sockaddr*)&addr, sizeof(addr));
+	if(r < 0)
+	{ return -1; }
+
+	int canfd = 1;
+	r = setsockopt(s, SOL_CAN_RAW, CAN_RAW_FD_FRAMES, &canfd, sizeof(int));
+	if(r < 0)
+	{ return -1; }
+
+	// prefer hardware receive timestamps, fall back to software timestamps
+	int timestamping = SOF_TIMESTAMPING_RX_HARDWARE | SOF_TIMESTAMPING_RAW_HARDWARE | SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE;
+	r = setsockopt(s, SOL_SOCKET, SO_TIMESTAMPING, &timestamping, sizeof(int));
+	if(r < 0)
+	{
+		int timestamp = 1;
+		r = setsockopt(s, SOL_SOCKET, SO_TIMESTAMP, &timestamp, sizeof(int));
+		if(r < 0)
+		{ return -1; }
+	}
+
+	for(uint_fast8_t i = 0; i < WLMIO_CAN_TX_BATCH_SIZE; i += 1)
+	{
+		ctx->can_tx_iov[i].iov_base = &ctx->can_tx_frames[i];
+		ctx->can_tx_iov[i].iov_len = sizeof(struct canfd_frame);
+
+		ctx->can_tx_msgs[i].msg_hdr = (struct msghdr)
+		{
+			.msg_iov = &ctx->can_tx_iov[i],
+			.msg_iovlen = 1
+		};
+	}
+
+	for(uint_fast8_t i = 0; i < WLMIO_CAN_RX_BATCH_SIZE; i += 1)
+	{
+		ctx->can_rx_iov[i].iov_base = &ctx->can_rx_frames[i];
+		ctx->can_rx_iov[i].iov_len = sizeof(struct canfd_frame);
+
+		ctx->can_rx_msgs[i].msg_hdr = (struct msghdr)
+		{
+			.msg_iov = &ctx->can_rx_iov[i],
+			.msg_iovlen = 1,
+			.msg_control = ctx->can_rx_control[i],
+			.msg_controllen = CAN_RX_CONTROL_SIZE
+		};
+	}
+
 	return s;
 }
 
 
-int32_t wlmio_init(void)
+// Build CAN_RAW_FILTER rules from the active libcanard subscriptions so that the kernel drops
+// traffic we would discard anyway: messages on subjects we are not subscribed to and service
+// transfers addressed to other nodes. Rules only require extended data frames and match the
+// port ID, service flags and destination node ID; the remaining bits are left to libcanard.
+static int can_filter_update(struct wlmio_ctx* const ctx)
+{
+	if(ctx->can_sock < 0)
+	{ return 0; }
+
+	struct can_filter filters[WLMIO_CAN_FILTER_MAX];
+	size_t count = 0;
+
+	for(uint_fast8_t kind = 0; kind < CANARD_NUM_TRANSFER_KINDS; kind += 1)
+	{
+		for(const CanardRxSubscription* sub = ctx->canard._rx_subscriptions[kind]; sub != NULL; sub = sub->_next)
+		{
+			if(count >= WLMIO_CAN_FILTER_MAX)
+			{
+				// too many rules, let everything through
+				filters[0] = (struct can_filter) { .can_id = 0, .can_mask = 0 };
+				count = 1;
+				goto apply;
+			}
+
+			canid_t id = CAN_EFF_FLAG;
+			canid_t mask = CAN_EFF_FLAG | CAN_RTR_FLAG | (UINT32_C(1) << 25);
+
+			if(kind == CanardTransferKindMessage)
+			{
+				id |= (canid_t)sub->_port_id << 8;
+				mask |= (canid_t)CANARD_SUBJECT_ID_MAX << 8;
+			}
+			else
+			{
+				id |= (UINT32_C(1) << 25) | ((canid_t)sub->_port_id << 14) | ((canid_t)ctx->canard.node_id << 7);
+				if(kind == CanardTransferKindRequest)
+				{ id |= UINT32_C(1) << 24; }
+				mask |= (UINT32_C(1) << 24) | ((canid_t)CANARD_SERVICE_ID_MAX << 14) | ((canid_t)CANARD_NODE_ID_MAX << 7);
+			}
+
+			filters[count] = (struct can_filter) { .can_id = id, .can_mask = mask };
+			count += 1;
+		}
+	}
+
+apply:
+	return setsockopt(ctx->can_sock, SOL_CAN_RAW, CAN_RAW_FILTER, filters, count * sizeof(struct can_filter));
+}
+
+
+static int8_t uavcan_subscribe(struct wlmio_ctx* const ctx, const CanardTransferKind kind, const CanardPortID port_id, const size_t extent, CanardRxSubscription* const sub)
+{
+	const int8_t r = canardRxSubscribe(&ctx->canard, kind, port_id, extent, CANARD_DEFAULT_TRANSFER_ID_TIMEOUT_USEC, sub);
+	if(r < 0)
+	{ return r; }
+
+	can_filter_update(ctx);
+
+	return r;
+}
+
+
+struct wlmio_cq* wlmio_cq_open(const size_t capacity)
+{
+	if(capacity == 0)
+	{ return NULL; }
+
+	struct wlmio_cq* const cq = calloc(1, sizeof(struct wlmio_cq));
+	if(!cq)
+	{ return NULL; }
+
+	if(mpsc_init(&cq->queue, capacity, sizeof(struct cq_entry)) < 0)
+	{
+		free(cq);
+		return NULL;
+	}
+
+	cq->fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	if(cq->fd < 0)
+	{
+		mpsc_deinit(&cq->queue);
+		free(cq);
+		return NULL;
+	}
+
+	cq->capacity = capacity;
+	atomic_init(&cq->outstanding, 0);
+
+	return cq;
+}
+
+
+void wlmio_cq_close(struct wlmio_cq* const cq)
+{
+	if(!cq)
+	{ return; }
+
+	close(cq->fd);
+	mpsc_deinit(&cq->queue);
+	free(cq);
+}
+
+
+int64_t wlmio_cq_get_fd(const struct wlmio_cq* const cq)
+{
+	return cq->fd;
+}
+
+
+size_t wlmio_cq_dispatch(struct wlmio_cq* const cq)
+{
+	uint64_t e;
+	read(cq->fd, &e, sizeof(e));
+
+	size_t n = 0;
+	struct cq_entry entry;
+	while(mpsc_pop(&cq->queue, &entry) == 0)
+	{
+		atomic_fetch_sub_explicit(&cq->outstanding, 1, memory_order_relaxed);
+		entry.callback(entry.r, entry.uparam);
+		n += 1;
+	}
+
+	return n;
+}
+
+
+// called on the event loop thread, the slot was reserved when the request was submitted
+static void cq_complete(struct wlmio_cq* const cq, void (* const callback)(int32_t r, void* uparam), void* const uparam, const int32_t r)
+{
+	const struct cq_entry entry = { .callback = callback, .uparam = uparam, .r = r };
+	mpsc_push(&cq->queue, &entry);
+
+	const uint64_t one = 1;
+	write(cq->fd, &one, sizeof(one));
+}
+
+
+struct submit_request
+{
+	struct wlmio_ctx* ctx;
+	struct wlmio_cq* cq;
+	void (* callback)(int32_t r, void* uparam);
+	void* uparam;
+};
+
+
+static void submit_request_callback(int32_t r, void* const p)
+{
+	struct submit_request* const t = p;
+
+	cq_complete(t->cq, t->callback, t->uparam, r);
+	slab_free(&t->ctx->slab, p);
+}
+
+
+static void submit_issue(struct wlmio_ctx* const ctx, const struct submit_entry* const e)
+{
+	void (* callback)(int32_t r, void* uparam) = e->callback;
+	void* uparam = e->uparam;
+	struct submit_request* t = NULL;
+	int32_t r;
+
+	// route the completion through the submitter's queue
+	if(e->cq)
+	{
+		r = slab_alloc(&ctx->slab, sizeof(struct submit_request), (void**)&t);
+		if(r < 0)
+		{ goto fail; }
+
+		t->ctx = ctx;
+		t->cq = e->cq;
+		t->callback = e->callback;
+		t->uparam = e->uparam;
+
+		callback = submit_request_callback;
+		uparam = t;
+	}
+
+	switch(e->kind)
+	{
+		case SUBMIT_REGISTER_ACCESS:
+			r = wlmio_register_access_ctx(ctx, e->node_id, e->reg.name, e->reg.write ? &e->reg.regw : NULL, e->reg.regr, callback, uparam);
+			break;
+
+		case SUBMIT_EXECUTE_COMMAND:
+			r = wlmio_execute_command_ctx(ctx, e->node_id, e->cmd.command, e->cmd.param, e->cmd.param_len, callback, uparam);
+			break;
+
+		default:
+			r = -EINVAL;
+			break;
+	}
+
+	if(r < 0)
+	{
+		slab_free(&ctx->slab, t);
+		goto fail;
+	}
+
+	return;
+
+fail:
+	// the request never reached the bus, report it like a failed request
+	if(e->cq)
+	{ cq_complete(e->cq, e->callback, e->uparam, r); }
+	else
+	{ e->callback(r, e->uparam); }
+}
+
+
+static void submit_handler(struct wlmio_ctx* const ctx, struct fd_entry* const entry, const uint32_t events)
+{
+	uint64_t e;
+	read(entry->fd, &e, sizeof(e));
+
+	// clear before draining so a submission racing with the drain signals again
+	atomic_store(&ctx->submit_pending, false);
+
+	struct submit_entry s;
+	for(size_t i = 0; i < WLMIO_SUBMIT_QUEUE_CAPACITY; i += 1)
+	{
+		if(mpsc_pop(&ctx->submit_queue, &s) < 0)
+		{ return; }
+
+		submit_issue(ctx, &s);
+	}
+
+	// budget used up, come back after the other events have been handled
+	if(!atomic_exchange(&ctx->submit_pending, true))
+	{
+		const uint64_t one = 1;
+		write(ctx->submit_fd, &one, sizeof(one));
+	}
+}
+
+
+static int32_t submit_push(struct wlmio_ctx* const ctx, const struct submit_entry* const e)
+{
+	if(e->cq && atomic_fetch_add_explicit(&e->cq->outstanding, 1, memory_order_relaxed) >= e->cq->capacity)
+	{
+		atomic_fetch_sub_explicit(&e->cq->outstanding, 1, memory_order_relaxed);
+		return -EBUSY;
+	}
+
+	const int32_t r = mpsc_push(&ctx->submit_queue, e);
+	if(r < 0)
+	{
+		if(e->cq)
+		{ atomic_fetch_sub_explicit(&e->cq->outstanding, 1, memory_order_relaxed); }
+		return r;
+	}
+
+	// wake the event loop thread unless a wakeup is already on its way
+	if(!atomic_exchange(&ctx->submit_pending, true))
+	{
+		const uint64_t one = 1;
+		write(ctx->submit_fd, &one, sizeof(one));
+	}
+
+	return 0;
+}
+
+
+int32_t wlmio_submit_register_access_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const char* const name, const struct wlmio_register_access* const regw, struct wlmio_register_access* const regr, struct wlmio_cq* const cq, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	if(
+		node_id > CANARD_NODE_ID_MAX
+		|| name == NULL
+		|| strnlen(name, 51) > 50
+		|| (regw == NULL && regr == NULL)
+		|| callback == NULL
+	)
+	{ return -EINVAL; }
+
+	struct submit_entry e =
+	{
+		.kind = SUBMIT_REGISTER_ACCESS,
+		.node_id = node_id,
+		.cq = cq,
+		.callback = callback,
+		.uparam = uparam
+	};
+
+	strcpy(e.reg.name, name);
+	e.reg.write = regw != NULL;
+	if(regw)
+	{ e.reg.regw = *regw; }
+	e.reg.regr = regr;
+
+	return submit_push(ctx, &e);
+}
+
+
+int32_t wlmio_submit_register_access(const uint8_t node_id, const char* const name, const struct wlmio_register_access* const regw, struct wlmio_register_access* const regr, struct wlmio_cq* const cq, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	return wlmio_submit_register_access_ctx(default_ctx, node_id, name, regw, regr, cq, callback, uparam);
+}
+
+
+int32_t wlmio_submit_execute_command_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint16_t command, const void* const param, size_t param_len, struct wlmio_cq* const cq, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	if(node_id > CANARD_NODE_ID_MAX || (param == NULL && param_len > 0) || callback == NULL)
+	{ return -EINVAL; }
+
+	struct submit_entry e =
+	{
+		.kind = SUBMIT_EXECUTE_COMMAND,
+		.node_id = node_id,
+		.cq = cq,
+		.callback = callback,
+		.uparam = uparam
+	};
+
+	param_len = param_len > 112 ? 112 : param_len;
+	e.cmd.command = command;
+	e.cmd.param_len = param_len;
+	if(param_len > 0)
+	{ memcpy(e.cmd.param, param, param_len); }
+
+	return submit_push(ctx, &e);
+}
+
+
+int32_t wlmio_submit_execute_command(const uint8_t node_id, const uint16_t command, const void* const param, const size_t param_len, struct wlmio_cq* const cq, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	return wlmio_submit_execute_command_ctx(default_ctx, node_id, command, param, param_len, cq, callback, uparam);
+}
+
+
+struct wlmio_ctx* wlmio_ctx_open(const char* const ifname, const int32_t node_id)
+{
+	// a negative node ID means the ID is read from the address jumpers
+	if(ifname == NULL || (node_id >= 0 && node_id > (int32_t)CANARD_NODE_ID_MAX))
+	{ return NULL; }
+
+	struct wlmio_ctx* const ctx = calloc(1, sizeof(struct wlmio_ctx));
+	if(!ctx)
+	{ return NULL; }
+
+	ctx->epollfd = -1;
+	ctx->can_sock = -1;
+	ctx->timer_fd = -1;
+	ctx->submit_fd = -1;
+	ctx->timeout = 2000000ULL;
+	atomic_init(&ctx->submit_pending, false);
+	timer_init(&ctx->can_tx_retry, can_tx_retry_handler);
+
+	int32_t r = pool_init(&ctx->pool, pool_arena_size, pool_lock_memory);
+	if(r < 0)
+	{ goto fail; }
+
+	r = slab_init(&ctx->slab, WLMIO_REQUEST_SLAB_CAPACITY, SLAB_OBJECT_SIZE);
+	if(r < 0)
+	{ goto fail; }
+
+	r = slab_init(&ctx->group_slab, WLMIO_GROUP_SLAB_CAPACITY, SLAB_LARGE_OBJECT_SIZE);
+	if(r < 0)
+	{ goto fail; }
+
+	ctx->canard = canardInit(&mem_allocate, &mem_free);
+	ctx->canard.user_reference = ctx;
+	ctx->canard.mtu_bytes = CANARD_MTU_CAN_FD;
+	ctx->canard.rx_single_frame_zero_copy = true;
+
+	const int32_t id = node_id < 0 ? get_node_id() : node_id;
+	if(id < 0)
+	{ goto fail; }
+	ctx->canard.node_id = id;
+
+	ctx->epollfd = epoll_create1(EPOLL_CLOEXEC);
+	if(ctx->epollfd < 0)
+	{ goto fail; }
+
+	ctx->timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+	if(ctx->timer_fd < 0)
+	{ goto fail; }
+	if(!fd_entry_add(ctx, ctx->timer_fd, timer_handler, EPOLLIN))
+	{
+		close(ctx->timer_fd);
+		goto fail;
+	}
+
+	r = mpsc_init(&ctx->submit_queue, WLMIO_SUBMIT_QUEUE_CAPACITY, sizeof(struct submit_entry));
+	if(r < 0)
+	{ goto fail; }
+
+	ctx->submit_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	if(ctx->submit_fd < 0)
+	{ goto fail; }
+	if(!fd_entry_add(ctx, ctx->submit_fd, submit_handler, EPOLLIN))
+	{
+		close(ctx->submit_fd);
+		goto fail;
+	}
+
+	ctx->can_sock = can_socket_init(ctx, ifname);
+	if(ctx->can_sock < 0)
+	{ goto fail; }
+
+	uavcan_subscribe(ctx, CanardTransferKindResponse, 385, 51, &ctx->register_list_subscription);
+	uavcan_subscribe(ctx, CanardTransferKindResponse, 384, 267, &ctx->register_access_subscription);
+	uavcan_subscribe(ctx, CanardTransferKindResponse, 435, 1, &ctx->command_subscription);
+	uavcan_subscribe(ctx, CanardTransferKindResponse, 430, 313, &ctx->node_info_subscription);
+	uavcan_subscribe(ctx, CanardTransferKindMessage, 7509, 7, &ctx->heartbeat_subscription);
+
+  // init node status
+  for(uint_fast8_t i = 0; i <= CANARD_NODE_ID_MAX; i += 1)
+  {
+    ctx->nodes[i] = (struct wlmio_status)
+    {
+      .uptime = 0,
+      .health = WLMIO_HEALTH_NOMINAL,
+      .mode = WLMIO_MODE_OFFLINE,
+      .vendor_status = 0
+    };
+
+		timer_init(&ctx->heartbeat_timers[i], heartbeat_timeout_handler);
+		ctx->node_queue_tail[i] = &ctx->node_queue_head[i];
+  }
+
+	return ctx;
+
+fail:
+	wlmio_ctx_close(ctx);
+	return NULL;
+}
+
+
+int32_t wlmio_init(void)
+{
+	if(default_ctx)
+	{ return 0; }
+
+	default_ctx = wlmio_ctx_open("can0", -1);
+
+	return default_ctx ? 0 : -1;
+}
+
+
+int32_t wlmio_tick_ctx(struct wlmio_ctx* const ctx)
+{
+	// while(1)
+	// {
+	// 	CanardTransfer tfr;
+	// 	int r = receive_transfer(&tfr);
+	// 	if(r <= 0)
+	// 	{ break; }
+
+	// 	if(tfr.port_id == 7509 && tfr.transfer_kind == CanardTransferKindMessage)
+	// 	{ heartbeat_handler(&tfr); }
+
+	// 	else if(tfr.port_id == 430 && tfr.transfer_kind == CanardTransferKindResponse)
+	// 	{ get_node_info_response_handler(&tfr); }
+
+	// 	else if(tfr.port_id == 385 && tfr.transfer_kind == CanardTransferKindResponse)
+	// 	{ register_list_response_handler(&tfr); }
+
+	// 	else if(tfr.port_id == 384 && tfr.transfer_kind == CanardTransferKindResponse)
+	// 	{ register_access_response_handler(&tfr); }
+
+	// 	else if(tfr.port_id == 435 && tfr.transfer_kind == CanardTransferKindResponse)
+	// 	{ execute_command_response_handler(&tfr); }
+
+	// 	// free transfer payload after processing if there is one
+	// 	if(tfr.payload_size > 0 && tfr.payload != NULL) { free((void*)tfr.payload); }
+	// }
+
+	struct epoll_event events[WLMIO_EPOLL_BATCH_SIZE];
+	while(1)
+	{
+		const int32_t n = epoll_wait(ctx->epollfd, events, WLMIO_EPOLL_BATCH_SIZE, 0);
+		if(n <= 0)
+		{ break; }
+
+		for(int32_t i = 0; i < n; i += 1)
+		{
+			struct fd_entry* const entry = events[i].data.ptr;
+			entry->handler(ctx, entry, events[i].events);
+		}
+
+		// flush responses between batches so they are not held back by a long receive burst
+		uavcan_send(ctx);
+
+		// a partial batch means everything that was ready has been handled
+		if(n < WLMIO_EPOLL_BATCH_SIZE)
+		{ break; }
+	}
+
+	// handle heartbeat timeouts
+	// for(uint_fast8_t i = 0; i <= CANARD_NODE_ID_MAX; i += 1)
+  // {
+  //   if(timers[i] < 0)
+  //   { continue; }
+
+  //   uint64_t e;
+  //   int r = read(timers[i], &e, sizeof(e));
+  //   if(r == -1 && errno == EAGAIN)
+  //   { continue; }
+
+  //   close(timers[i]);
+  //   timers[i] = -1;
+
+  //   const struct wlmio_status old_status = nodes[i];
+  //   nodes[i] = (struct wlmio_status)
+  //   {
+  //     .uptime = 0,
+  //     .health = WLMIO_HEALTH_NOMINAL,
+  //     .mode = WLMIO_MODE_OFFLINE,
+  //     .vendor_status = 0
+  //   };
+
+  //   if(user_callback)
+  //   { user_callback(i, &old_status, &nodes[i]); }
+  // }
+
+	return 0;
+}
+
+
+int32_t wlmio_tick(void)
+{
+	return wlmio_tick_ctx(default_ctx);
+}
+
+
+// Issue a request right away if its node has nothing queued and a transfer ID and concurrency slot
+// are free, otherwise queue it behind the node's other requests. The response timeout runs from
+// submission either way.
+static int64_t request_submit(struct wlmio_ctx* const ctx, const uint8_t service, const uint8_t node_id, const void* const payload, const size_t payload_size, const struct wlmio_request_options* const opts, void* const param, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+  assert(ctx->epollfd >= 0);
+	assert(callback);
+
+	if(opts && opts->priority > WLMIO_PRIORITY_OPTIONAL)
+	{ return -EINVAL; }
+
+	const uint64_t now = monotonic_usec();
+	const uint64_t timeout = opts && opts->timeout ? opts->timeout : ctx->timeout;
+
+	struct task_entry* entry;
+	int32_t r = slab_alloc(&ctx->slab, sizeof(struct task_entry), (void**)&entry);
+	if(r < 0)
+	{ return r; }
+
+	*entry = (struct task_entry)
+	{
+		.param = param,
+		.callback = callback,
+		.uparam = uparam,
+		.node_id = node_id,
+		.service = service,
+		.priority = opts ? opts->priority : WLMIO_PRIORITY_NOMINAL,
+		.tx_deadline = opts && opts->tx_deadline ? now + opts->tx_deadline : 0
+	};
+
+	timer_init(&entry->timer, async_handler);
+	r = timer_schedule(ctx, &entry->timer, now + timeout);
+	if(r < 0)
+	{
+		task_free(ctx, entry);
+		return r;
+	}
+
+	if(!ctx->node_queue_head[node_id] && request_can_issue(ctx, entry))
+	{
+		r = request_issue(ctx, entry, payload, payload_size);
+		if(r < 0)
+		{ goto fail; }
+
+		if(!ctx->tx_corked)
+		{ uavcan_send(ctx); }
+
+		return task_handle(ctx, entry);
+	}
+
+	if(payload_size > 0)
+	{
+		entry->payload = pool_alloc(&ctx->pool, payload_size);
+		if(!entry->payload)
+		{
+			r = -ENOMEM;
+			goto fail;
+		}
+
+		memcpy(entry->payload, payload, payload_size);
+	}
+
+	entry->payload_size = payload_size;
+	entry->queued = true;
+	entry->next = NULL;
+	*ctx->node_queue_tail[node_id] = entry;
+	ctx->node_queue_tail[node_id] = &entry->next;
+
+	return task_handle(ctx, entry);
+
+fail:
+	timer_cancel(ctx, &entry->timer);
+	task_free(ctx, entry);
+	return r;
+}
+
+
+int64_t wlmio_get_node_info_ex_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, struct wlmio_node_info* const node_info, const struct wlmio_request_options* const opts, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	if(node_id > CANARD_NODE_ID_MAX || node_info == NULL || callback == NULL)
+	{ return -EINVAL; }
+
+	return request_submit(ctx, REQUEST_SERVICE_NODE_INFO, node_id, NULL, 0, opts, node_info, callback, uparam);
+}
+
+
+int32_t wlmio_get_node_info(const uint8_t node_id, struct wlmio_node_info* const node_info, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	return wlmio_get_node_info_ctx(default_ctx, node_id, node_info, callback, uparam);
+}
+
+
+int32_t wlmio_get_node_info_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, struct wlmio_node_info* const node_info, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	const int64_t r = wlmio_get_node_info_ex_ctx(ctx, node_id, node_info, NULL, callback, uparam);
+	return r < 0 ? r : 0;
+}
+
+
+int64_t wlmio_get_node_info_ex(const uint8_t node_id, struct wlmio_node_info* const node_info, const struct wlmio_request_options* const opts, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	return wlmio_get_node_info_ex_ctx(default_ctx, node_id, node_info, opts, callback, uparam);
+}
+
+
+void wlmio_set_timeout_ctx(struct wlmio_ctx* const ctx, const uint64_t us)
+{
+	ctx->timeout = us;
+}
+
+
+void wlmio_set_timeout(const uint64_t us)
+{
+	wlmio_set_timeout_ctx(default_ctx, us);
+}
+
+
+int32_t wlmio_set_heartbeat_timeout_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint64_t us)
+{
+	if(node_id > CANARD_NODE_ID_MAX)
+	{ return -EINVAL; }
+
+	ctx->heartbeat_timeouts[node_id] = us;
+
+	// move a running timer so the new timeout applies to the current period
+	if(ctx->heartbeat_timers[node_id].index != TIMER_UNSCHEDULED)
+	{ return timer_schedule(ctx, &ctx->heartbeat_timers[node_id], heartbeat_deadline(ctx, node_id)); }
+
+	return 0;
+}
+
+
+int32_t wlmio_set_heartbeat_timeout(const uint8_t node_id, const uint64_t us)
+{
+	return wlmio_set_heartbeat_timeout_ctx(default_ctx, node_id, us);
+}
+
+
+int32_t wlmio_set_node_request_limit_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint16_t limit)
+{
+	if(node_id > CANARD_NODE_ID_MAX)
+	{ return -EINVAL; }
+
+	ctx->node_limits[node_id] = limit;
+
+	// a higher limit may let queued requests through
+	request_pump(ctx, node_id);
+	uavcan_send(ctx);
+
+	return 0;
+}
+
+
+int32_t wlmio_set_node_request_limit(const uint8_t node_id, const uint16_t limit)
+{
+	return wlmio_set_node_request_limit_ctx(default_ctx, node_id, limit);
+}
+
+
+int32_t wlmio_cancel_ctx(struct wlmio_ctx* const ctx, const int64_t handle)
+{
+	const int32_t r = async_cancel(ctx, handle, -ECANCELED);
+
+	// queued requests of the node may have been issued into the freed slot
+	if(r == 0 && !ctx->tx_corked)
+	{ uavcan_send(ctx); }
+
+	return r;
+}
+
+
+int32_t wlmio_cancel(const int64_t handle)
+{
+	return wlmio_cancel_ctx(default_ctx, handle);
+}
+
+
+int32_t wlmio_cancel_node_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id)
+{
+	if(node_id > CANARD_NODE_ID_MAX)
+	{ return -EINVAL; }
+
+	const size_t n = async_cancel_node(ctx, node_id, -ECANCELED);
+
+	// the callbacks may have issued new requests
+	if(n > 0 && !ctx->tx_corked)
+	{ uavcan_send(ctx); }
+
+	return n;
+}
+
+
+int32_t wlmio_cancel_node(const uint8_t node_id)
+{
+	return wlmio_cancel_node_ctx(default_ctx, node_id);
+}
+
+
+void wlmio_set_offline_fails_requests_ctx(struct wlmio_ctx* const ctx, const uint8_t enable)
+{
+	ctx->offline_fails_requests = enable;
+}
+
+
+void wlmio_set_offline_fails_requests(const uint8_t enable)
+{
+	wlmio_set_offline_fails_requests_ctx(default_ctx, enable);
+}
+
+
+void wlmio_wait_for_event_ctx(struct wlmio_ctx* const ctx)
+{
+	struct epoll_event ev;
+	epoll_wait(ctx->epollfd, &ev, 1, -1);
+	// int n = epoll_wait(epollfd, &ev, 1, -1);
+	// if(n <= 0)
+	// { return;	}
+
+	// wlmio_tick();
+}
+
+
+void wlmio_wait_for_event(void)
+{
+	wlmio_wait_for_event_ctx(default_ctx);
+}
+
+
+int64_t wlmio_register_list_ex_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint16_t index, char* const name, const struct wlmio_request_options* const opts, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	if(node_id > CANARD_NODE_ID_MAX || name == NULL) { return -EINVAL; }
+
+	return request_submit(ctx, REQUEST_SERVICE_REGISTER_LIST, node_id, &index, 2, opts, name, callback, uparam);
+}
+
+
+int32_t wlmio_register_list(const uint8_t node_id, const uint16_t index, char* const name, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	return wlmio_register_list_ctx(default_ctx, node_id, index, name, callback, uparam);
+}
+
+
+int32_t wlmio_register_list_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint16_t index, char* const name, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	const int64_t r = wlmio_register_list_ex_ctx(ctx, node_id, index, name, NULL, callback, uparam);
+	return r < 0 ? r : 0;
+}
+
+
+int64_t wlmio_register_list_ex(const uint8_t node_id, const uint16_t index, char* const name, const struct wlmio_request_options* const opts, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	return wlmio_register_list_ex_ctx(default_ctx, node_id, index, name, opts, callback, uparam);
+}
+
+
+// Encodes the value part of a register access request at payload, regw NULL encodes a read.
+// Returns the number of bytes written.
+static size_t register_access_encode_value(uint8_t* const payload, const struct wlmio_register_access* const regw)
+{
+	size_t payload_offset = 0;
+
+	if(regw != NULL)
+	{ memcpy(payload + payload_offset, &regw->type, 1); }
+	else
+	{ memset(payload + payload_offset, WLMIO_REGISTER_VALUE_EMPTY, 1); }
+	payload_offset += 1;
+
+	if(regw != NULL && regw->type != WLMIO_REGISTER_VALUE_EMPTY)
+	{
+		// array length
+		memcpy(payload + payload_offset, &regw->length, register_value_length_width[regw->type]);
+		payload_offset += register_value_length_width[regw->type];
+
+		// register value
+		const size_t bytes = (regw->length * register_value_bit_width[regw->type]) >> 3;
+		assert(bytes <= 256);
+		memcpy(payload + payload_offset, regw->value, bytes);
+		payload_offset += bytes;
+	}
+
+	return payload_offset;
+}
+
+
+// Encodes the name length and name of a register access request at payload. Returns the number
+// of bytes written.
+static size_t register_access_encode_name(uint8_t* const payload, const char* const name)
+{
+	const uint8_t name_len = strnlen(name, 50);
+
+	memcpy(payload, &name_len, 1);
+	memcpy(payload + 1, name, name_len);
+
+	return name_len + 1;
+}
+
+
+static int32_t register_access_validate(const uint8_t node_id, const char* const name, const struct wlmio_register_access* const regw, const struct wlmio_register_access* const regr)
+{
+	if(
+		node_id >= CANARD_NODE_ID_MAX
+		|| name == NULL
+		|| name[0] == '\0'
+		|| (regw == NULL && regr == NULL)
+		|| (regw != NULL && validate_register_access(regw) != 0)
+	)
+	{ return -EINVAL; }
+
+	return 0;
+}
+
+
+static void read_flight_callback(int32_t r, void* const p)
+{
+	struct read_flight* const f = p;
+	struct wlmio_ctx* const ctx = f->ctx;
+
+	// unlink first so reads issued from the callbacks start a new transfer
+	struct read_flight** l = &ctx->read_flights;
+	while(*l != f)
+	{ l = &(*l)->next; }
+	*l = f->next;
+
+	// the callbacks may cancel other waiters of this read, their handles are stale from here on
+	for(struct task_entry* w = f->waiters; w; w = w->next)
+	{
+		task_invalidate(ctx, w);
+		if(r >= 0 && w->param != f->regr)
+		{ *(struct wlmio_register_access*)w->param = *f->regr; }
+	}
+
+	struct task_entry* w = f->waiters;
+	while(w)
+	{
+		struct task_entry* const next = w->next;
+		w->callback(r, w->uparam);
+		task_free(ctx, w);
+		w = next;
+	}
+
+	slab_free(&ctx->slab, f);
+}
+
+
+// Detach a single reader from its read. The response is redirected to another waiter's buffer if
+// it was going to the leaving one, and the transfer is cancelled once nobody is waiting for it.
+static void read_waiter_cancel(struct wlmio_ctx* const ctx, struct task_entry* const waiter, const int32_t r)
+{
+	struct read_flight* const f = waiter->flight;
+
+	struct task_entry** l = &f->waiters;
+	while(*l != waiter)
+	{ l = &(*l)->next; }
+	*l = waiter->next;
+	if(!waiter->next)
+	{ f->waiters_tail = l; }
+
+	if(f->waiters && f->regr == waiter->param)
+	{
+		f->regr = f->waiters->param;
+
+		struct task_entry* const c = task_from_handle(ctx, f->handle);
+		if(c)
+		{ c->param = f->regr; }
+	}
+
+	void (* const callback)(int32_t r, void* uparam) = waiter->callback;
+	void* const uparam = waiter->uparam;
+	task_free(ctx, waiter);
+
+	if(!f->waiters)
+	{ async_cancel(ctx, f->handle, -ECANCELED); }
+
+	callback(r, uparam);
+}
+
+
+static int64_t read_waiter_add(struct wlmio_ctx* const ctx, struct read_flight* const f, struct wlmio_register_access* const regr, void (* const callback)(int32_t r, void* uparam), void* const uparam)
 {
-	canard = canardInit(&mem_allocate, &mem_free);
-	canard.mtu_bytes = CANARD_MTU_CAN_FD;
-	
-	const int32_t node_id = get_node_id();
-	if(node_id < 0) { return -1; }
-	canard.node_id = node_id;
+	struct task_entry* w;
+	const int32_t r = slab_alloc(&ctx->slab, sizeof(struct task_entry), (void**)&w);
+	if(r < 0)
+	{ return r; }
 
-	epollfd = epoll_create1(0);
-	if(epollfd < 0)
-	{	return -1; }
-	
-	can_sock = can_socket_init();
-	
-	static CanardRxSubscription register_list_subscription;
-	canardRxSubscribe(
-		&canard,
-		CanardTransferKindResponse,
-		385,
-		51,
-		CANARD_DEFAULT_TRANSFER_ID_TIMEOUT_USEC,
-		&register_list_subscription
-	);
-	
-	static CanardRxSubscription register_access_subscription;
-	canardRxSubscribe(
-		&canard,
-		CanardTransferKindResponse,
-		384,
-		267,
-		CANARD_DEFAULT_TRANSFER_ID_TIMEOUT_USEC,
-		&register_access_subscription
-	);
-
-	static CanardRxSubscription command_subscription;
-  canardRxSubscribe(
-    &canard,
-    CanardTransferKindResponse,
-    435,
-    1,
-    CANARD_DEFAULT_TRANSFER_ID_TIMEOUT_USEC,
-    &command_subscription
-  );
-
-	static CanardRxSubscription node_info_subscription;
-  canardRxSubscribe(
-    &canard,
-    CanardTransferKindResponse,
-    430,
-    313,
-    CANARD_DEFAULT_TRANSFER_ID_TIMEOUT_USEC,
-    &node_info_subscription
-  );
-  
-  static CanardRxSubscription heartbeat_subscription;
-  canardRxSubscribe(
-    &canard,
-    CanardTransferKindMessage,
-    7509,
-    7,
-    CANARD_DEFAULT_TRANSFER_ID_TIMEOUT_USEC,
-    &heartbeat_subscription
-  );
-  
-  // init node status
-  for(uint_fast8_t i = 0; i <= CANARD_NODE_ID_MAX; i += 1)
-  {
-    nodes[i] = (struct wlmio_status)
-    {
-      .uptime = 0,
-      .health = WLMIO_HEALTH_NOMINAL,
-      .mode = WLMIO_MODE_OFFLINE,
-      .vendor_status = 0
-    };
+	*w = (struct task_entry)
+	{
+		.param = regr,
+		.callback = callback,
+		.uparam = uparam,
+		.node_id = f->node_id,
+		.flight = f
+	};
+	timer_init(&w->timer, async_handler);
 
-		timers[i] = -1;
-  }
-	
-	return can_sock < 0 ? -1 : 0;
+	*f->waiters_tail = w;
+	f->waiters_tail = &w->next;
+
+	return task_handle(ctx, w);
 }
 
 
-int32_t wlmio_tick(void)
-{	
-	// while(1)
-	// {
-	// 	CanardTransfer tfr;
-	// 	int r = receive_transfer(&tfr);
-	// 	if(r <= 0)
-	// 	{ break; }
-		
-	// 	if(tfr.port_id == 7509 && tfr.transfer_kind == CanardTransferKindMessage)
-	// 	{ heartbeat_handler(&tfr); }
-		
-	// 	else if(tfr.port_id == 430 && tfr.transfer_kind == CanardTransferKindResponse)
-	// 	{ get_node_info_response_handler(&tfr); }
+// name is only used to find a pending read of the same register, payload is the encoded request
+// sent if there is none
+static int64_t register_read_coalesce(struct wlmio_ctx* const ctx, const uint8_t node_id, const char* const name, const uint8_t* const payload, const size_t payload_size, struct wlmio_register_access* const regr, const struct wlmio_request_options* const opts, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	const uint8_t priority = opts ? opts->priority : WLMIO_PRIORITY_NOMINAL;
 
-	// 	else if(tfr.port_id == 385 && tfr.transfer_kind == CanardTransferKindResponse)
-	// 	{ register_list_response_handler(&tfr); }
+	// the same deadlines request_submit() gives the request of a new flight
+	const uint64_t now = monotonic_usec();
+	const uint64_t timeout_at = now + (opts && opts->timeout ? opts->timeout : ctx->timeout);
+	const uint64_t tx_deadline = opts && opts->tx_deadline ? now + opts->tx_deadline : 0;
 
-	// 	else if(tfr.port_id == 384 && tfr.transfer_kind == CanardTransferKindResponse)
-	// 	{ register_access_response_handler(&tfr); }
+	for(struct read_flight* f = ctx->read_flights; f; f = f->next)
+	{
+		if(
+			!f->joinable
+			|| f->node_id != node_id
+			|| f->priority != priority
+			|| f->timeout_at > timeout_at
+			|| (tx_deadline != 0 && (f->tx_deadline == 0 || f->tx_deadline > tx_deadline))
+			|| strncmp(f->name, name, 50) != 0
+		)
+		{ continue; }
+
+		return read_waiter_add(ctx, f, regr, callback, uparam);
+	}
 
-	// 	else if(tfr.port_id == 435 && tfr.transfer_kind == CanardTransferKindResponse)
-	// 	{ execute_command_response_handler(&tfr); }
-		
-	// 	// free transfer payload after processing if there is one
-	// 	if(tfr.payload_size > 0 && tfr.payload != NULL) { free((void*)tfr.payload); }
-	// }
+	struct read_flight* f;
+	int64_t r = slab_alloc(&ctx->slab, sizeof(struct read_flight), (void**)&f);
+	if(r < 0)
+	{ return r; }
 
-	while(1)
+	*f = (struct read_flight)
 	{
-		struct epoll_event ev;
-		int32_t r = epoll_wait(epollfd, &ev, 1, 0);
-		if(r <= 0)
-		{ break; }
+		.ctx = ctx,
+		.node_id = node_id,
+		.priority = priority,
+		.joinable = true,
+		.timeout_at = timeout_at,
+		.tx_deadline = tx_deadline,
+		.regr = regr,
+		.waiters = NULL
+	};
+	f->waiters_tail = &f->waiters;
+	strncpy(f->name, name, 50);
+	f->name[50] = '\0';
 
-		struct fd_entry* entry = ev.data.ptr;
-		entry->handler(entry);
+	const int64_t h = read_waiter_add(ctx, f, regr, callback, uparam);
+	if(h < 0)
+	{
+		slab_free(&ctx->slab, f);
+		return h;
 	}
 
-	uavcan_send();
+	r = request_submit(ctx, REQUEST_SERVICE_REGISTER_ACCESS, node_id, payload, payload_size, opts, regr, read_flight_callback, f);
+	if(r < 0)
+	{
+		task_free(ctx, f->waiters);
+		slab_free(&ctx->slab, f);
+		return r;
+	}
 
-	// async_tick();
-	
-	// handle heartbeat timeouts
-	// for(uint_fast8_t i = 0; i <= CANARD_NODE_ID_MAX; i += 1)
-  // {
-  //   if(timers[i] < 0)
-  //   { continue; }
+	f->handle = r;
+	f->next = ctx->read_flights;
+	ctx->read_flights = f;
 
-  //   uint64_t e;
-  //   int r = read(timers[i], &e, sizeof(e));
-  //   if(r == -1 && errno == EAGAIN)
-  //   { continue; }
+	return h;
+}
 
-  //   close(timers[i]);
-  //   timers[i] = -1;
 
-  //   const struct wlmio_status old_status = nodes[i];
-  //   nodes[i] = (struct wlmio_status)
-  //   {
-  //     .uptime = 0,
-  //     .health = WLMIO_HEALTH_NOMINAL,
-  //     .mode = WLMIO_MODE_OFFLINE,
-  //     .vendor_status = 0
-  //   };
+// reads issued after a write to a register must not be answered by a read issued before it
+static void read_flight_close(struct wlmio_ctx* const ctx, const uint8_t node_id, const char* const name, const size_t name_len)
+{
+	for(struct read_flight* f = ctx->read_flights; f; f = f->next)
+	{
+		if(f->node_id == node_id && strlen(f->name) == name_len && memcmp(f->name, name, name_len) == 0)
+		{ f->joinable = false; }
+	}
+}
 
-  //   if(user_callback)
-  //   { user_callback(i, &old_status, &nodes[i]); }
-  // }
-	
-	return 0;
+
+int64_t wlmio_register_access_ex_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const char* const name, const struct wlmio_register_access* const regw, struct wlmio_register_access* const regr, const struct wlmio_request_options* const opts, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	const int32_t r = register_access_validate(node_id, name, regw, regr);
+	if(r < 0)
+	{ return r; }
+
+	uint8_t payload[310];
+	size_t payload_size = register_access_encode_name(payload, name);
+	payload_size += register_access_encode_value(payload + payload_size, regw);
+
+	if(regw == NULL && callback != NULL)
+	{ return register_read_coalesce(ctx, node_id, name, payload, payload_size, regr, opts, callback, uparam); }
+
+	if(regw != NULL)
+	{ read_flight_close(ctx, node_id, (const char*)payload + 1, payload[0]); }
+
+	return request_submit(ctx, REQUEST_SERVICE_REGISTER_ACCESS, node_id, payload, payload_size, opts, regr, callback, uparam);
 }
 
 
-// timeout in microseconds
-static uint64_t timeout = 2000000ULL;
+int32_t wlmio_register_access(const uint8_t node_id, const char* const name, const struct wlmio_register_access* const regw, struct wlmio_register_access* const regr, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	return wlmio_register_access_ctx(default_ctx, node_id, name, regw, regr, callback, uparam);
+}
 
 
-int32_t wlmio_get_node_info(const uint8_t node_id, struct wlmio_node_info* const node_info, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+int32_t wlmio_register_access_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const char* const name, const struct wlmio_register_access* const regw, struct wlmio_register_access* const regr, void (* const callback)(int32_t r, void* uparam), void* const uparam)
 {
-	static uint8_t tfr_ids[128] = { 0 };
+	const int64_t r = wlmio_register_access_ex_ctx(ctx, node_id, name, regw, regr, NULL, callback, uparam);
+	return r < 0 ? r : 0;
+}
 
-	if(node_id > CANARD_NODE_ID_MAX || node_info == NULL || callback == NULL)
-	{ return -EINVAL; }
 
-	const CanardTransfer tfr_tx =
-	{
-		.timestamp_usec = 0,
-		.priority = CanardPriorityNominal,
-		.transfer_kind = CanardTransferKindRequest,
-		.port_id = 430,
-		.remote_node_id = node_id,
-		.transfer_id = tfr_ids[node_id],
-		.payload_size = 0,
-		.payload = NULL
-	};
-	canardTxPush(&canard, &tfr_tx);
+int64_t wlmio_register_access_ex(const uint8_t node_id, const char* const name, const struct wlmio_register_access* const regw, struct wlmio_register_access* const regr, const struct wlmio_request_options* const opts, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	return wlmio_register_access_ex_ctx(default_ctx, node_id, name, regw, regr, opts, callback, uparam);
+}
+
 
-	tfr_ids[node_id] = (tfr_ids[node_id] + 1) & 0x1F;
+int32_t wlmio_register_template_init(struct wlmio_register_template* const t, const uint8_t node_id, const char* const name)
+{
+	if(t == NULL || node_id >= CANARD_NODE_ID_MAX || name == NULL || name[0] == '\0')
+	{ return -EINVAL; }
 
-	async_add(make_rsp_specifier(&tfr_tx), timeout, node_info, callback, uparam);
-	uavcan_send();
+	t->node_id = node_id;
+	t->name_size = register_access_encode_name(t->payload, name);
 
 	return 0;
 }
 
 
-void wlmio_set_timeout(const uint64_t us)
+// The node and name are already encoded in the template, an access only writes the value part
+// behind them and submits the template's buffer, which request_submit() copies before returning.
+int64_t wlmio_register_template_access_ex_ctx(struct wlmio_ctx* const ctx, struct wlmio_register_template* const t, const struct wlmio_register_access* const regw, struct wlmio_register_access* const regr, const struct wlmio_request_options* const opts, void (* const callback)(int32_t r, void* uparam), void* const uparam)
 {
-	timeout = us;
+	if(
+		t == NULL
+		|| t->name_size < 2
+		|| (regw == NULL && regr == NULL)
+		|| (regw != NULL && validate_register_access(regw) != 0)
+	)
+	{ return -EINVAL; }
+
+	const size_t payload_size = t->name_size + register_access_encode_value(t->payload + t->name_size, regw);
+
+	// a read encodes an empty value, whose zero type byte terminates the name for the lookup
+	if(regw == NULL && callback != NULL)
+	{ return register_read_coalesce(ctx, t->node_id, (const char*)t->payload + 1, t->payload, payload_size, regr, opts, callback, uparam); }
+
+	if(regw != NULL)
+	{ read_flight_close(ctx, t->node_id, (const char*)t->payload + 1, t->payload[0]); }
+
+	return request_submit(ctx, REQUEST_SERVICE_REGISTER_ACCESS, t->node_id, t->payload, payload_size, opts, regr, callback, uparam);
 }
 
 
-void wlmio_wait_for_event(void)
+int32_t wlmio_register_template_access(struct wlmio_register_template* const t, const struct wlmio_register_access* const regw, struct wlmio_register_access* const regr, void (* const callback)(int32_t r, void* uparam), void* const uparam)
 {
-	struct epoll_event ev;
-	epoll_wait(epollfd, &ev, 1, -1);
-	// int n = epoll_wait(epollfd, &ev, 1, -1);
-	// if(n <= 0)
-	// { return;	}
+	return wlmio_register_template_access_ctx(default_ctx, t, regw, regr, callback, uparam);
+}
 
-	// wlmio_tick();
+
+int32_t wlmio_register_template_access_ctx(struct wlmio_ctx* const ctx, struct wlmio_register_template* const t, const struct wlmio_register_access* const regw, struct wlmio_register_access* const regr, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	const int64_t r = wlmio_register_template_access_ex_ctx(ctx, t, regw, regr, NULL, callback, uparam);
+	return r < 0 ? r : 0;
 }
 
 
-int32_t wlmio_register_list(const uint8_t node_id, const uint16_t index, char* const name, void (* const callback)(int32_t r, void* uparam), void* const uparam)
-{	
-	static uint8_t tfr_ids[128] = { 0 };
-	
-	if(node_id > CANARD_NODE_ID_MAX || name == NULL) { return -EINVAL; }
-	
-	const CanardTransfer tfr_tx =
-	{
-		.timestamp_usec = 0,
-		.priority = CanardPriorityNominal,
-		.transfer_kind = CanardTransferKindRequest,
-		.port_id = 385,
-		.remote_node_id = node_id,
-		.transfer_id = tfr_ids[node_id],
-		.payload_size = 2,
-		.payload = &index
-	};
-	canardTxPush(&canard, &tfr_tx);
-	
-	tfr_ids[node_id] = (tfr_ids[node_id] + 1) & 0x1F;
+int64_t wlmio_register_template_access_ex(struct wlmio_register_template* const t, const struct wlmio_register_access* const regw, struct wlmio_register_access* const regr, const struct wlmio_request_options* const opts, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	return wlmio_register_template_access_ex_ctx(default_ctx, t, regw, regr, opts, callback, uparam);
+}
 
-	async_add(make_rsp_specifier(&tfr_tx), timeout, name, callback, uparam);
-	uavcan_send();
-	
-	return 0;
+
+static void register_group_callback(const int32_t r, void* const p)
+{
+	struct register_group** const member = p;
+	struct register_group* const g = *member;
+
+	g->ops[member - g->members].status = r;
+	g->remaining -= 1;
+	if(g->remaining > 0)
+	{ return; }
+
+	int32_t status = 0;
+	for(size_t i = 0; i < g->n && status == 0; i += 1)
+	{ status = g->ops[i].status < 0 ? g->ops[i].status : 0; }
+
+	g->callback(status, g->uparam);
+	slab_free(&g->ctx->slab, g);
 }
 
 
-int32_t wlmio_register_access(const uint8_t node_id, const char* const name, const struct wlmio_register_access* const regw, struct wlmio_register_access* const regr, void (* const callback)(int32_t r, void* uparam), void* const uparam)
-{	
-	static uint8_t tfr_ids[128] = { 0 };
+int32_t wlmio_register_access_many_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, struct wlmio_register_op* const ops, const size_t n, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	if(node_id >= CANARD_NODE_ID_MAX || ops == NULL || n == 0 || n > WLMIO_REGISTER_OPS_MAX || callback == NULL)
+	{ return -EINVAL; }
 
-	int32_t r;
-	
-	if(
-		node_id >= CANARD_NODE_ID_MAX
-		|| name == NULL
-		|| name[0] == '\0'
-		|| (regw == NULL && regr == NULL)
-		|| (regw != NULL && validate_register_access(regw) != 0)
-	)
+	for(size_t i = 0; i < n; i += 1)
 	{
-		r = -EINVAL;
-		goto exit1;
+		const struct wlmio_register_op* const op = &ops[i];
+		if(
+			op->name == NULL
+			|| op->name[0] == '\0'
+			|| (op->regw == NULL && op->regr == NULL)
+			|| (op->regw != NULL && validate_register_access(op->regw) != 0)
+		)
+		{ return -EINVAL; }
 	}
-	
-	const uint8_t name_len = strnlen(name, 50);
-	
-	void* const payload = malloc(310);
-	size_t payload_offset = 0;
-	
-	memcpy(payload + payload_offset, &name_len, 1);
-	payload_offset += 1;
-	memcpy(payload + payload_offset, name, name_len);
-	payload_offset += name_len;
-	
-	if(regw != NULL)
-	{ memcpy(payload + payload_offset, &regw->type, 1); }
-	else
-	{ memset(payload + payload_offset, WLMIO_REGISTER_VALUE_EMPTY, 1); }
-	payload_offset += 1;
-	
-	if(regw != NULL && regw->type != WLMIO_REGISTER_VALUE_EMPTY)
+
+	struct register_group* g;
+	int32_t r = slab_alloc(&ctx->slab, sizeof(struct register_group), (void**)&g);
+	if(r < 0)
+	{ return r; }
+
+	g->ops = ops;
+	g->ctx = ctx;
+	g->callback = callback;
+	g->uparam = uparam;
+	g->n = n;
+	g->remaining = 0;
+
+	// No callback runs before this returns, so counting the issued operations as they go cannot
+	// complete the group early. An operation that could not be issued keeps its error as status.
+	ctx->tx_corked += 1;
+	for(size_t i = 0; i < n; i += 1)
 	{
-		// array length
-		memcpy(payload + payload_offset, &regw->length, register_value_length_width[regw->type]);
-		payload_offset += register_value_length_width[regw->type];
-		
-		// register value
-		const size_t bytes = (regw->length * register_value_bit_width[regw->type]) >> 3;
-		assert(bytes <= 256);
-		memcpy(payload + payload_offset, regw->value, bytes);
-		payload_offset += bytes;
+		g->members[i] = g;
+		ops[i].status = -EINPROGRESS;
+
+		const int64_t h = wlmio_register_access_ex_ctx(ctx, node_id, ops[i].name, ops[i].regw, ops[i].regr, NULL, register_group_callback, &g->members[i]);
+		if(h < 0)
+		{
+			ops[i].status = h;
+			if(r == 0)
+			{ r = h; }
+		}
+		else
+		{ g->remaining += 1; }
 	}
-	
-	const CanardTransfer tfr_tx =
+	ctx->tx_corked -= 1;
+
+	if(g->remaining == 0)
 	{
-		.timestamp_usec = 0,
-		.priority = CanardPriorityNominal,
-		.transfer_kind = CanardTransferKindRequest,
-		.port_id = 384,
-		.remote_node_id = node_id,
-		.transfer_id = tfr_ids[node_id],
-		.payload_size = payload_offset,
-		.payload = payload
-	};
-	canardTxPush(&canard, &tfr_tx);
-	tfr_ids[node_id] = (tfr_ids[node_id] + 1) & 0x1F;
-	
-	free(payload);
-	
-	async_add(make_rsp_specifier(&tfr_tx), timeout, regr, callback, uparam);
-	uavcan_send();
+		slab_free(&ctx->slab, g);
+		return r;
+	}
 
-	r = 0;
+	if(!ctx->tx_corked)
+	{ uavcan_send(ctx); }
 
-exit1:
-	return r;
+	return 0;
 }
 
 
-int32_t wlmio_execute_command(const uint8_t node_id, const uint16_t command, const void* const param, size_t param_len, void (* const callback)(int32_t r, void* uparam), void* const uparam)
-{	
-	static uint8_t tfr_ids[128] = { 0 };
-	
+int32_t wlmio_register_access_many(const uint8_t node_id, struct wlmio_register_op* const ops, const size_t n, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	return wlmio_register_access_many_ctx(default_ctx, node_id, ops, n, callback, uparam);
+}
+
+
+int64_t wlmio_execute_command_ex_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint16_t command, const void* const param, size_t param_len, const struct wlmio_request_options* const opts, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
 	if(node_id > CANARD_NODE_ID_MAX || (param == NULL && param_len > 0)) { return -EINVAL; }
-	
-	void* const payload = malloc(115);
-	if(payload == NULL) { return -ENOMEM; }
 
+	uint8_t payload[115];
 	size_t payload_offset = 0;
 
 	memcpy(payload + payload_offset, &command, 2);
@@ -1163,43 +2866,97 @@ int32_t wlmio_execute_command(const uint8_t node_id, const uint16_t command, con
 		payload_offset += param_len;
 	}
 
-	const CanardTransfer tfr_tx =
-	{
-		.timestamp_usec = 0,
-		.priority = CanardPriorityNominal,
-		.transfer_kind = CanardTransferKindRequest,
-		.port_id = 435,
-		.remote_node_id = node_id,
-		.transfer_id = tfr_ids[node_id],
-		.payload_size = payload_offset,
-		.payload = payload
-	};
-	canardTxPush(&canard, &tfr_tx);
-	free(payload);
-	
-	tfr_ids[node_id] = (tfr_ids[node_id] + 1) & 0x1F;
+	return request_submit(ctx, REQUEST_SERVICE_EXECUTE_COMMAND, node_id, payload, payload_offset, opts, NULL, callback, uparam);
+}
 
-	async_add(make_rsp_specifier(&tfr_tx), timeout, NULL, callback, uparam);
-	uavcan_send();
-	
-	return 0;
+
+int32_t wlmio_execute_command(const uint8_t node_id, const uint16_t command, const void* const param, const size_t param_len, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	return wlmio_execute_command_ctx(default_ctx, node_id, command, param, param_len, callback, uparam);
+}
+
+
+int32_t wlmio_execute_command_ctx(struct wlmio_ctx* const ctx, const uint8_t node_id, const uint16_t command, const void* const param, const size_t param_len, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	const int64_t r = wlmio_execute_command_ex_ctx(ctx, node_id, command, param, param_len, NULL, callback, uparam);
+	return r < 0 ? r : 0;
+}
+
+
+int64_t wlmio_execute_command_ex(const uint8_t node_id, const uint16_t command, const void* const param, const size_t param_len, const struct wlmio_request_options* const opts, void (* const callback)(int32_t r, void* uparam), void* const uparam)
+{
+	return wlmio_execute_command_ex_ctx(default_ctx, node_id, command, param, param_len, opts, callback, uparam);
+}
+
+
+void wlmio_set_status_callback_ctx(struct wlmio_ctx* const ctx, void (* const callback)(uint8_t node_id, const struct wlmio_status* old_status, const struct wlmio_status* new_status))
+{
+  ctx->user_callback = callback;
 }
 
 
 void wlmio_set_status_callback(void (* const callback)(uint8_t node_id, const struct wlmio_status* old_status, const struct wlmio_status* new_status))
 {
-  user_callback = callback;
+  wlmio_set_status_callback_ctx(default_ctx, callback);
+}
+
+
+uint64_t wlmio_get_tx_expired_count_ctx(struct wlmio_ctx* const ctx)
+{
+	return ctx->tx_expired;
+}
+
+
+uint64_t wlmio_get_tx_expired_count(void)
+{
+	return wlmio_get_tx_expired_count_ctx(default_ctx);
+}
+
+
+int64_t wlmio_get_epoll_fd_ctx(struct wlmio_ctx* const ctx)
+{
+	return ctx->epollfd;
 }
 
 
 int64_t wlmio_get_epoll_fd(void)
 {
-	return epollfd;
+	return default_ctx ? default_ctx->epollfd : -1;
+}
+
+
+int32_t wlmio_pool_configure(const size_t arena_size, const uint8_t lock_memory)
+{
+	if(default_ctx)
+	{ return -EBUSY; }
+
+	pool_arena_size = arena_size;
+	pool_lock_memory = lock_memory;
+
+	return 0;
+}
+
+
+size_t wlmio_get_pool_stats_ctx(struct wlmio_ctx* const ctx, struct wlmio_pool_stats* const stats, const size_t count)
+{
+	return pool_get_stats(&ctx->pool, stats, count);
+}
+
+
+size_t wlmio_get_pool_stats(struct wlmio_pool_stats* const stats, const size_t count)
+{
+	return wlmio_get_pool_stats_ctx(default_ctx, stats, count);
+}
+
+
+uint8_t wlmio_get_node_id_ctx(struct wlmio_ctx* const ctx)
+{
+	return ctx->canard.node_id;
 }
 
 
 uint8_t wlmio_get_node_id(void)
 {
-	assert(epollfd >= 0);
-	return canard.node_id;
+	assert(default_ctx);
+	return wlmio_get_node_id_ctx(default_ctx);
 }
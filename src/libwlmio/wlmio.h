@@ -15,18 +15,6 @@ enum wlmio_transfer
   WLMIO_TRANSFER_REQUEST = 2
 };
 
-enum wlmio_priority
-{
-  WLMIO_PRIORITY_EXCEPTIONAL = 0,
-  WLMIO_PRIORITY_IMMEDIATE = 1,
-  WLMIO_PRIORITY_FAST = 2,
-  WLMIO_PRIORITY_HIGH = 3,
-  WLMIO_PRIORITY_NOMINAL = 4,
-  WLMIO_PRIORITY_LOW = 5,
-  WLMIO_PRIORITY_SLOW = 6,
-  WLMIO_PRIORITY_OPTIONAL = 7
-};
-
 struct wlmio_transfer
 {
   uint64_t timestamp_usec;
@@ -39,6 +27,18 @@ struct wlmio_transfer
 };
 #endif
 
+enum wlmio_priority
+{
+  WLMIO_PRIORITY_EXCEPTIONAL = 0,
+  WLMIO_PRIORITY_IMMEDIATE = 1,
+  WLMIO_PRIORITY_FAST = 2,
+  WLMIO_PRIORITY_HIGH = 3,
+  WLMIO_PRIORITY_NOMINAL = 4,
+  WLMIO_PRIORITY_LOW = 5,
+  WLMIO_PRIORITY_SLOW = 6,
+  WLMIO_PRIORITY_OPTIONAL = 7
+};
+
 enum wlmio_health
 {
   WLMIO_HEALTH_NOMINAL = 0,
@@ -136,6 +136,124 @@ struct wlmio_node_info
   uint32_t flags;
 };
 
+// name, type and array length of one register of a node
+struct wlmio_register_schema
+{
+  char name[51];
+  uint8_t type;
+  uint16_t length;
+};
+
+struct wlmio_pool_stats
+{
+  size_t block_size;
+  size_t blocks;
+  size_t used;
+  size_t high_water;
+  size_t failures;
+};
+
+// Per-request settings accepted by the _ex functions, a NULL options pointer behaves like the
+// function without the _ex suffix. The _ex functions return a handle for wlmio_cancel() if
+// success, which is never negative, else a negative error code.
+struct wlmio_request_options
+{
+  // CAN arbitration priority, see enum wlmio_priority, lower values win
+  uint8_t priority;
+  // time in microseconds after submission after which the request frames are dropped instead of
+  // sent, 0 for no deadline
+  uint64_t tx_deadline;
+  // response timeout in microseconds, 0 uses the value set with wlmio_set_timeout()
+  uint64_t timeout;
+};
+
+// Register access request with the node and register name encoded in advance by
+// wlmio_register_template_init(), the members are private to the library
+struct wlmio_register_template
+{
+  uint8_t node_id;
+  uint8_t name_size;
+  uint8_t payload[310];
+};
+
+#define WLMIO_REGISTER_OPS_MAX 32
+
+// one operation of wlmio_register_access_many()
+struct wlmio_register_op
+{
+  const char* name;
+  // value to write, NULL to only read
+  const struct wlmio_register_access* regw;
+  // receives the register value, may be NULL when writing
+  struct wlmio_register_access* regr;
+  // result of the operation, valid once the group's callback runs
+  int32_t status;
+};
+
+// library state for one CAN interface, the functions without a _ctx suffix use a default context
+// opened on can0 by wlmio_init()
+struct wlmio_ctx;
+
+// completion queue delivering results of submitted requests to the thread that dispatches it
+struct wlmio_cq;
+
+// cyclic I/O scanner maintaining a process image of register values
+struct wlmio_scanner;
+
+enum wlmio_scan_direction
+{
+  WLMIO_SCAN_INPUT = 0,
+  WLMIO_SCAN_OUTPUT = 1
+};
+
+enum wlmio_scan_quality
+{
+  // the point has not been accessed yet
+  WLMIO_SCAN_QUALITY_NONE = 0,
+  // the last access succeeded
+  WLMIO_SCAN_QUALITY_GOOD = 1,
+  // the last access failed, the value is from an earlier successful access
+  WLMIO_SCAN_QUALITY_STALE = 2,
+  // no access has succeeded yet
+  WLMIO_SCAN_QUALITY_BAD = 3
+};
+
+struct wlmio_scan_point
+{
+  uint8_t node_id;
+  // see enum wlmio_scan_direction
+  uint8_t direction;
+  char name[51];
+  // minimum time in microseconds between accesses to the point, 0 accesses it every cycle
+  uint64_t period;
+};
+
+struct wlmio_scan_value
+{
+  // register value read from an input, or returned by the node after writing an output
+  struct wlmio_register_access value;
+  // CLOCK_MONOTONIC time in microseconds of the last successful access
+  uint64_t timestamp;
+  // result of the last access
+  int32_t status;
+  // see enum wlmio_scan_quality
+  uint8_t quality;
+};
+
+// all times in microseconds
+struct wlmio_scan_stats
+{
+  uint64_t cycles;
+  // cycles started while requests of the previous cycle were outstanding or after a missed cycle
+  uint64_t overruns;
+  // time from the start of a cycle until the last of its requests completed
+  uint64_t cycle_time;
+  uint64_t cycle_time_max;
+  // how late a cycle started after its scheduled time
+  uint64_t jitter;
+  uint64_t jitter_max;
+};
+
 
 /**
  * Initializes the library
@@ -156,24 +274,265 @@ int32_t wlmio_tick(void);
 int wlmio_shutdown(void);
 void wlmio_wait_for_event(void);
 void wlmio_set_timeout(uint64_t us);
+
+/**
+ * Sets how long a node may go without a heartbeat before it is reported offline
+ *
+ * @param us Timeout in microseconds, 0 restores the default of 3 seconds
+ * @return Returns 0 if success else -EINVAL
+*/
+int32_t wlmio_set_heartbeat_timeout(uint8_t node_id, uint64_t us);
+
+/**
+ * Sets how many requests may await a response from a node at once, further requests to the node
+ * are queued and issued in order as responses arrive
+ *
+ * @param limit Maximum number of outstanding requests, 0 restores the default of 8
+ * @return Returns 0 if success else -EINVAL
+*/
+int32_t wlmio_set_node_request_limit(uint8_t node_id, uint16_t limit);
+
+/**
+ * Cancels a pending request, its callback is run with -ECANCELED before this returns
+ *
+ * @param handle Handle returned by one of the _ex functions
+ * @return Returns 0 if success else -ENOENT if the request has already completed
+*/
+int32_t wlmio_cancel(int64_t handle);
+
+/**
+ * Cancels all pending requests to a node, their callbacks are run with -ECANCELED
+ *
+ * @return Returns the number of requests cancelled else -EINVAL
+*/
+int32_t wlmio_cancel_node(uint8_t node_id);
+
+/**
+ * Fail all pending requests to a node with -EHOSTDOWN when its heartbeat times out instead of
+ * letting each one run into its response timeout. Disabled by default.
+*/
+void wlmio_set_offline_fails_requests(uint8_t enable);
 int64_t wlmio_get_epoll_fd(void);
 
+/**
+ * @return Returns the number of frames dropped because their transmission deadline had passed
+*/
+uint64_t wlmio_get_tx_expired_count(void);
+
 void wlmio_set_status_callback(void (* callback)(uint8_t node_id, const struct wlmio_status* old_status, const struct wlmio_status* new_status));
 
 uint8_t wlmio_get_node_id(void);
 
+/**
+ * Sets the size of the memory arena used for protocol buffers by contexts opened afterwards, must
+ * be called before wlmio_init()
+ *
+ * @param lock_memory Lock the arena in RAM with mlock() so it never pages out
+ * @return Returns 0 if success else -EBUSY if the library is already initialized
+*/
+int32_t wlmio_pool_configure(size_t arena_size, uint8_t lock_memory);
+
+/**
+ * Reads the usage statistics of the memory arena, one entry per block size class
+ *
+ * @return Returns the number of size classes, which may be larger than count
+*/
+size_t wlmio_get_pool_stats(struct wlmio_pool_stats* stats, size_t count);
+
 /**
  * List the registers present on a node one at a time.
  *
  * @param name The name pointer must point to an array of at least 51 bytes
 */
 int32_t wlmio_register_list(uint8_t node_id, uint16_t index, char* name, void (* callback)(int32_t r, void* uparam), void* uparam);
+
+/**
+ * Reads and/or writes a register on a node.
+ *
+ * A read (regw NULL) of a register that is already being read from the same node at the same
+ * priority joins the pending read rather than sending another request, provided the pending read
+ * times out and drops its frames no later than the new one would and no write to the register has
+ * been issued since it was sent. Every reader gets the
+ * result, but its regr is only guaranteed to be written if the read succeeds. Each reader has a
+ * handle of its own, cancelling one only detaches that reader and the request is dropped once no
+ * reader is left.
+*/
 int32_t wlmio_register_access(uint8_t node_id, const char* name, const struct wlmio_register_access* regw, struct wlmio_register_access* regr, void (* callback)(int32_t r, void* uparam), void* uparam);
 
+/**
+ * Encodes the node and register name of a register access once, so accesses through the template
+ * only encode the value. The template may live on the stack or in static storage and is not
+ * referenced by the library after an access returns.
+ *
+ * @return Returns 0 if success else -EINVAL
+*/
+int32_t wlmio_register_template_init(struct wlmio_register_template* t, uint8_t node_id, const char* name);
+
+/**
+ * Same as wlmio_register_access() for the node and register of the template. Reads join pending
+ * reads of the same register like reads by name do.
+*/
+int32_t wlmio_register_template_access(struct wlmio_register_template* t, const struct wlmio_register_access* regw, struct wlmio_register_access* regr, void (* callback)(int32_t r, void* uparam), void* uparam);
+int64_t wlmio_register_template_access_ex(struct wlmio_register_template* t, const struct wlmio_register_access* regw, struct wlmio_register_access* regr, const struct wlmio_request_options* opts, void (* callback)(int32_t r, void* uparam), void* uparam);
+
+/**
+ * Issues up to WLMIO_REGISTER_OPS_MAX register accesses on a node as one group. The requests are
+ * handed to the socket together and the callback runs once after all of them have completed.
+ *
+ * The ops array must stay valid until the callback has run, each operation reports its own
+ * result in its status member.
+ *
+ * @return Returns 0 if success, else the error of the first operation that could not be issued if
+ * none could be, in which case the callback is not run. The callback receives 0 if every
+ * operation succeeded, else the status of the first one that failed.
+*/
+int32_t wlmio_register_access_many(uint8_t node_id, struct wlmio_register_op* ops, size_t n, void (* callback)(int32_t r, void* uparam), void* uparam);
+
 int32_t wlmio_execute_command(uint8_t node_id, uint16_t command, const void* param, size_t param_len, void (* callback)(int32_t r, void* uparam), void* uparam);
 
+/**
+ * Lists the registers of a node with their types and lengths.
+ *
+ * Schemas are cached by node unique ID and firmware revision in files under /var/cache/wlmio, so a
+ * node is only enumerated register by register the first time its firmware is seen. The schema
+ * known for a node ID is forgotten when the node restarts or goes offline, a query that a restart
+ * interrupts starts over and only fails with -EAGAIN if it keeps being interrupted.
+ *
+ * @param schema Receives up to capacity registers, must stay valid until the callback has run
+ * @return Returns 0 if success else a negative error code. The callback receives the number of
+ * registers of the node, which may be larger than capacity, or a negative error code.
+*/
+int32_t wlmio_get_register_schema(uint8_t node_id, struct wlmio_register_schema* schema, size_t capacity, void (* callback)(int32_t r, void* uparam), void* uparam);
+
+/**
+ * Sets the directory register schemas are cached in, NULL keeps them in memory only. Must not be
+ * called while a schema is being looked up.
+ *
+ * @return Returns 0 if success else -ENAMETOOLONG
+*/
+int32_t wlmio_set_schema_cache_dir(const char* dir);
+
 int32_t wlmio_get_node_info(uint8_t node_id, struct wlmio_node_info* node_info, void (* callback)(int32_t r, void* uparam), void* uparam);
 
+int64_t wlmio_register_list_ex(uint8_t node_id, uint16_t index, char* name, const struct wlmio_request_options* opts, void (* callback)(int32_t r, void* uparam), void* uparam);
+int64_t wlmio_register_access_ex(uint8_t node_id, const char* name, const struct wlmio_register_access* regw, struct wlmio_register_access* regr, const struct wlmio_request_options* opts, void (* callback)(int32_t r, void* uparam), void* uparam);
+int64_t wlmio_execute_command_ex(uint8_t node_id, uint16_t command, const void* param, size_t param_len, const struct wlmio_request_options* opts, void (* callback)(int32_t r, void* uparam), void* uparam);
+int64_t wlmio_get_node_info_ex(uint8_t node_id, struct wlmio_node_info* node_info, const struct wlmio_request_options* opts, void (* callback)(int32_t r, void* uparam), void* uparam);
+
+
+/**
+ * Opens a context bound to one CAN interface. Each context owns its socket, epoll instance,
+ * timers, memory arena and node table, so several buses can be driven from one process with
+ * one thread per context. A context must only be used from the thread driving it, apart from the
+ * wlmio_submit functions.
+ *
+ * @param ifname CAN interface name, for example "can1"
+ * @param node_id Local node ID, or -1 to read it from the address jumpers
+ * @return Returns the context if success else NULL
+*/
+struct wlmio_ctx* wlmio_ctx_open(const char* ifname, int32_t node_id);
+void wlmio_ctx_close(struct wlmio_ctx* ctx);
+
+int32_t wlmio_tick_ctx(struct wlmio_ctx* ctx);
+void wlmio_wait_for_event_ctx(struct wlmio_ctx* ctx);
+void wlmio_set_timeout_ctx(struct wlmio_ctx* ctx, uint64_t us);
+int32_t wlmio_set_heartbeat_timeout_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint64_t us);
+int32_t wlmio_set_node_request_limit_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint16_t limit);
+int32_t wlmio_cancel_ctx(struct wlmio_ctx* ctx, int64_t handle);
+int32_t wlmio_cancel_node_ctx(struct wlmio_ctx* ctx, uint8_t node_id);
+void wlmio_set_offline_fails_requests_ctx(struct wlmio_ctx* ctx, uint8_t enable);
+int64_t wlmio_get_epoll_fd_ctx(struct wlmio_ctx* ctx);
+uint64_t wlmio_get_tx_expired_count_ctx(struct wlmio_ctx* ctx);
+void wlmio_set_status_callback_ctx(struct wlmio_ctx* ctx, void (* callback)(uint8_t node_id, const struct wlmio_status* old_status, const struct wlmio_status* new_status));
+uint8_t wlmio_get_node_id_ctx(struct wlmio_ctx* ctx);
+size_t wlmio_get_pool_stats_ctx(struct wlmio_ctx* ctx, struct wlmio_pool_stats* stats, size_t count);
+
+int32_t wlmio_register_list_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint16_t index, char* name, void (* callback)(int32_t r, void* uparam), void* uparam);
+int32_t wlmio_register_access_ctx(struct wlmio_ctx* ctx, uint8_t node_id, const char* name, const struct wlmio_register_access* regw, struct wlmio_register_access* regr, void (* callback)(int32_t r, void* uparam), void* uparam);
+int32_t wlmio_register_template_access_ctx(struct wlmio_ctx* ctx, struct wlmio_register_template* t, const struct wlmio_register_access* regw, struct wlmio_register_access* regr, void (* callback)(int32_t r, void* uparam), void* uparam);
+int64_t wlmio_register_template_access_ex_ctx(struct wlmio_ctx* ctx, struct wlmio_register_template* t, const struct wlmio_register_access* regw, struct wlmio_register_access* regr, const struct wlmio_request_options* opts, void (* callback)(int32_t r, void* uparam), void* uparam);
+int32_t wlmio_register_access_many_ctx(struct wlmio_ctx* ctx, uint8_t node_id, struct wlmio_register_op* ops, size_t n, void (* callback)(int32_t r, void* uparam), void* uparam);
+int32_t wlmio_get_register_schema_ctx(struct wlmio_ctx* ctx, uint8_t node_id, struct wlmio_register_schema* schema, size_t capacity, void (* callback)(int32_t r, void* uparam), void* uparam);
+int32_t wlmio_execute_command_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint16_t command, const void* param, size_t param_len, void (* callback)(int32_t r, void* uparam), void* uparam);
+int32_t wlmio_get_node_info_ctx(struct wlmio_ctx* ctx, uint8_t node_id, struct wlmio_node_info* node_info, void (* callback)(int32_t r, void* uparam), void* uparam);
+
+int64_t wlmio_register_list_ex_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint16_t index, char* name, const struct wlmio_request_options* opts, void (* callback)(int32_t r, void* uparam), void* uparam);
+int64_t wlmio_register_access_ex_ctx(struct wlmio_ctx* ctx, uint8_t node_id, const char* name, const struct wlmio_register_access* regw, struct wlmio_register_access* regr, const struct wlmio_request_options* opts, void (* callback)(int32_t r, void* uparam), void* uparam);
+int64_t wlmio_execute_command_ex_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint16_t command, const void* param, size_t param_len, const struct wlmio_request_options* opts, void (* callback)(int32_t r, void* uparam), void* uparam);
+int64_t wlmio_get_node_info_ex_ctx(struct wlmio_ctx* ctx, uint8_t node_id, struct wlmio_node_info* node_info, const struct wlmio_request_options* opts, void (* callback)(int32_t r, void* uparam), void* uparam);
+
+
+// thread safe request submission
+
+/**
+ * Opens a completion queue for a thread that submits requests.
+ *
+ * @param capacity Maximum number of requests that may be outstanding on the queue at once
+ * @return Returns the queue if success else NULL
+*/
+struct wlmio_cq* wlmio_cq_open(size_t capacity);
+void wlmio_cq_close(struct wlmio_cq* cq);
+
+/**
+ * @return Returns an eventfd that becomes readable when completions are waiting
+*/
+int64_t wlmio_cq_get_fd(const struct wlmio_cq* cq);
+
+/**
+ * Runs the callbacks of all completed requests on the calling thread
+ *
+ * @return Returns the number of callbacks run
+*/
+size_t wlmio_cq_dispatch(struct wlmio_cq* cq);
+
+/**
+ * Queues a register access from any thread, it is issued by the thread running wlmio_tick(). The
+ * name and write value are copied, regr must stay valid until the callback has run.
+ *
+ * @param cq Completion queue the callback is run from, or NULL to run it on the event loop thread
+ * @return Returns 0 if success, -EAGAIN if the submission queue is full or -EBUSY if the completion
+ * queue is full. Errors raised when the request is issued are passed to the callback.
+*/
+int32_t wlmio_submit_register_access(uint8_t node_id, const char* name, const struct wlmio_register_access* regw, struct wlmio_register_access* regr, struct wlmio_cq* cq, void (* callback)(int32_t r, void* uparam), void* uparam);
+int32_t wlmio_submit_execute_command(uint8_t node_id, uint16_t command, const void* param, size_t param_len, struct wlmio_cq* cq, void (* callback)(int32_t r, void* uparam), void* uparam);
+
+int32_t wlmio_submit_register_access_ctx(struct wlmio_ctx* ctx, uint8_t node_id, const char* name, const struct wlmio_register_access* regw, struct wlmio_register_access* regr, struct wlmio_cq* cq, void (* callback)(int32_t r, void* uparam), void* uparam);
+int32_t wlmio_submit_execute_command_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint16_t command, const void* param, size_t param_len, struct wlmio_cq* cq, void (* callback)(int32_t r, void* uparam), void* uparam);
+
+
+// cyclic I/O scanner
+
+/**
+ * Starts scanning a list of points every cycle_time microseconds. Each cycle reads the due inputs
+ * and writes the due outputs whose value has been set with wlmio_scanner_write(). Must be called
+ * from the thread running wlmio_tick() and closed before the context is.
+ *
+ * @param opts Options applied to every request of the scanner, or NULL for the defaults
+ * @return Returns the scanner if success else NULL
+*/
+struct wlmio_scanner* wlmio_scanner_open(const struct wlmio_scan_point* points, size_t count, uint64_t cycle_time, const struct wlmio_request_options* opts);
+void wlmio_scanner_close(struct wlmio_scanner* scanner);
+
+/**
+ * Sets the value written to an output point from the next time it is due. May be called from any
+ * one thread at a time.
+ *
+ * @param index Index of the point in the list passed to wlmio_scanner_open()
+ * @return Returns 0 if success else -EINVAL
+*/
+int32_t wlmio_scanner_write(struct wlmio_scanner* scanner, size_t index, const struct wlmio_register_access* value);
+
+/**
+ * Copies a consistent snapshot of the first count points of the process image and the cycle
+ * statistics. May be called from any thread, it never blocks the scanner.
+ *
+ * @param stats Receives the statistics, may be NULL
+ * @return Returns 0 if success else -EINVAL
+*/
+int32_t wlmio_scanner_read(const struct wlmio_scanner* scanner, struct wlmio_scan_value* image, size_t count, struct wlmio_scan_stats* stats);
+
+struct wlmio_scanner* wlmio_scanner_open_ctx(struct wlmio_ctx* ctx, const struct wlmio_scan_point* points, size_t count, uint64_t cycle_time, const struct wlmio_request_options* opts);
+
 
 // module specific functions
 
@@ -191,6 +550,7 @@ struct wlmio_vpe6010_input
 int32_t wlmio_vpe6010_read(uint8_t node_id, struct wlmio_vpe6010_input* dst, void (* callback)(int32_t r, void* uparam), void* uparam);
 
 int32_t wlmio_vpe6030_write(uint8_t node_id, uint8_t ch, uint8_t v, void (* callback)(int32_t r, void* uparam), void* uparam);
+int64_t wlmio_vpe6030_write_ex(uint8_t node_id, uint8_t ch, uint8_t v, const struct wlmio_request_options* opts, void (* callback)(int32_t r, void* uparam), void* uparam);
 
 enum wlmio_vpe6040
 {
@@ -199,6 +559,16 @@ enum wlmio_vpe6040
   WLMIO_VPE6040_MODE_10V = 2
 };
 int32_t wlmio_vpe6040_read(uint8_t node_id, uint8_t ch, uint16_t* v, void (* callback)(int32_t r, void* uparam), void* uparam);
+
+/**
+ * Reads every channel of a module with one wlmio_register_access_many() group. Channels that could
+ * not be read are left unchanged in v and the callback receives the first error.
+ *
+ * @param v Array with one element per channel: 4 on a VPE-6040, 8 on a VPE-6080 or VPE-6180, 6 on a
+ * VPE-6090 *
+ * @return Returns 0 if success or -EBUSY if too many of these reads are in flight on the context
+*/
+int32_t wlmio_vpe6040_read_all(uint8_t node_id, uint16_t* v, void (* callback)(int32_t r, void* uparam), void* uparam);
 int32_t wlmio_vpe6040_configure(uint8_t node_id, uint8_t ch, uint8_t mode, void (* callback)(int32_t r, void* uparam), void* uparam);
 
 enum wlmio_vpe6050
@@ -207,6 +577,7 @@ enum wlmio_vpe6050
   WLMIO_VPE6050_MODE_SINK = 1
 };
 int32_t wlmio_vpe6050_write(uint8_t node_id, uint8_t ch, uint16_t v, void (* callback)(int32_t r, void* uparam), void* uparam);
+int64_t wlmio_vpe6050_write_ex(uint8_t node_id, uint8_t ch, uint16_t v, const struct wlmio_request_options* opts, void (* callback)(int32_t r, void* uparam), void* uparam);
 int32_t wlmio_vpe6050_configure(uint8_t node_id, uint8_t ch, uint8_t mode, void (* callback)(int32_t r, void* uparam), void* uparam);
 
 enum wlmio_vpe6060
@@ -224,8 +595,10 @@ int32_t wlmio_vpe6060_read(uint8_t node_id, uint8_t ch, uint32_t* v, void (* cal
 int32_t wlmio_vpe6060_configure(uint8_t node_id, uint8_t ch, uint8_t mode, uint8_t polarity, uint8_t bias, void (* callback)(int32_t r, void* uparam), void* uparam);
 
 int32_t wlmio_vpe6070_write(uint8_t node_id, uint8_t ch, uint16_t v, void (* callback)(int32_t r, void* uparam), void* uparam);
+int64_t wlmio_vpe6070_write_ex(uint8_t node_id, uint8_t ch, uint16_t v, const struct wlmio_request_options* opts, void (* callback)(int32_t r, void* uparam), void* uparam);
 
 int32_t wlmio_vpe6080_read(uint8_t node_id, uint8_t ch, uint16_t* v, void (* callback)(int32_t r, void* uparam), void* uparam);
+int32_t wlmio_vpe6080_read_all(uint8_t node_id, uint16_t* v, void (* callback)(int32_t r, void* uparam), void* uparam);
 int32_t wlmio_vpe6080_configure(uint8_t node_id, uint8_t ch, uint8_t enabled, uint16_t beta, uint16_t t0, void (* callback)(int32_t r, void* uparam), void* uparam);
 
 enum wlmio_vpe6090
@@ -241,9 +614,11 @@ enum wlmio_vpe6090
   WLMIO_VPE6090_TYPE_T = 8
 };
 int32_t wlmio_vpe6090_read(uint8_t node_id, uint8_t ch, uint16_t* v, void (* callback)(int32_t r, void* uparam), void* uparam);
+int32_t wlmio_vpe6090_read_all(uint8_t node_id, uint16_t* v, void (* callback)(int32_t r, void* uparam), void* uparam);
 int32_t wlmio_vpe6090_configure(uint8_t node_id, uint8_t ch, uint8_t type, void (* callback)(int32_t r, void* uparam), void* uparam);
 
 int32_t wlmio_vpe6180_read(uint8_t node_id, uint8_t ch, uint16_t* v, void (* callback)(int32_t r, void* uparam), void* uparam);
+int32_t wlmio_vpe6180_read_all(uint8_t node_id, uint16_t* v, void (* callback)(int32_t r, void* uparam), void* uparam);
 
 int32_t wlmio_vpe6190_configure(uint8_t node_id, uint8_t ch, uint8_t enable, void (* callback)(int32_t r, void* uparam), void* uparam);
 int32_t wlmio_vpe6190_read(uint8_t node_id, uint8_t ch, uint32_t* v, void (* callback)(int32_t r, void* uparam), void* uparam);
@@ -261,6 +636,7 @@ int32_t wlmio_register_list_sync(uint8_t node_id, uint16_t index, char* name);
 int32_t wlmio_register_access_sync(uint8_t node_id, const char* name, const struct wlmio_register_access* regw, struct wlmio_register_access* regr);
 int32_t wlmio_execute_command_sync(uint8_t node_id, uint16_t command, const void* param, size_t param_len);
 int32_t wlmio_get_node_info_sync(uint8_t node_id, struct wlmio_node_info* node_info);
+int32_t wlmio_get_register_schema_sync(uint8_t node_id, struct wlmio_register_schema* schema, size_t capacity);
 
 int32_t wlmio_node_set_sample_interval_sync(uint8_t node_id, uint16_t sample_interval);
 int32_t wlmio_vpe6010_read_sync(uint8_t node_id, struct wlmio_vpe6010_input* dst);
@@ -280,6 +656,57 @@ int32_t wlmio_vpe6180_read_sync(uint8_t node_id, uint8_t ch, uint16_t* v);
 int32_t wlmio_vpe6190_configure_sync(uint8_t node_id, uint8_t ch, uint8_t enable);
 int32_t wlmio_vpe6190_read_sync(uint8_t node_id, uint8_t ch, uint32_t* v);
 
+
+// context variants of the module specific and blocking functions
+
+int32_t wlmio_node_set_sample_interval_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint16_t sample_interval, void (* callback)(int32_t r, void* uparam), void* uparam);
+int32_t wlmio_vpe6010_read_ctx(struct wlmio_ctx* ctx, uint8_t node_id, struct wlmio_vpe6010_input* dst, void (* callback)(int32_t r, void* uparam), void* uparam);
+int32_t wlmio_vpe6030_write_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint8_t ch, uint8_t v, void (* callback)(int32_t r, void* uparam), void* uparam);
+int64_t wlmio_vpe6030_write_ex_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint8_t ch, uint8_t v, const struct wlmio_request_options* opts, void (* callback)(int32_t r, void* uparam), void* uparam);
+int32_t wlmio_vpe6040_read_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint8_t ch, uint16_t* v, void (* callback)(int32_t r, void* uparam), void* uparam);
+int32_t wlmio_vpe6040_read_all_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint16_t* v, void (* callback)(int32_t r, void* uparam), void* uparam);
+int32_t wlmio_vpe6040_configure_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint8_t ch, uint8_t mode, void (* callback)(int32_t r, void* uparam), void* uparam);
+int32_t wlmio_vpe6050_write_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint8_t ch, uint16_t v, void (* callback)(int32_t r, void* uparam), void* uparam);
+int64_t wlmio_vpe6050_write_ex_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint8_t ch, uint16_t v, const struct wlmio_request_options* opts, void (* callback)(int32_t r, void* uparam), void* uparam);
+int32_t wlmio_vpe6050_configure_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint8_t ch, uint8_t mode, void (* callback)(int32_t r, void* uparam), void* uparam);
+int32_t wlmio_vpe6060_read_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint8_t ch, uint32_t* v, void (* callback)(int32_t r, void* uparam), void* uparam);
+int32_t wlmio_vpe6060_configure_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint8_t ch, uint8_t mode, uint8_t polarity, uint8_t bias, void (* callback)(int32_t r, void* uparam), void* uparam);
+int32_t wlmio_vpe6070_write_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint8_t ch, uint16_t v, void (* callback)(int32_t r, void* uparam), void* uparam);
+int64_t wlmio_vpe6070_write_ex_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint8_t ch, uint16_t v, const struct wlmio_request_options* opts, void (* callback)(int32_t r, void* uparam), void* uparam);
+int32_t wlmio_vpe6080_read_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint8_t ch, uint16_t* v, void (* callback)(int32_t r, void* uparam), void* uparam);
+int32_t wlmio_vpe6080_read_all_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint16_t* v, void (* callback)(int32_t r, void* uparam), void* uparam);
+int32_t wlmio_vpe6080_configure_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint8_t ch, uint8_t enabled, uint16_t beta, uint16_t t0, void (* callback)(int32_t r, void* uparam), void* uparam);
+int32_t wlmio_vpe6090_read_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint8_t ch, uint16_t* v, void (* callback)(int32_t r, void* uparam), void* uparam);
+int32_t wlmio_vpe6090_read_all_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint16_t* v, void (* callback)(int32_t r, void* uparam), void* uparam);
+int32_t wlmio_vpe6090_configure_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint8_t ch, uint8_t type, void (* callback)(int32_t r, void* uparam), void* uparam);
+int32_t wlmio_vpe6180_read_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint8_t ch, uint16_t* v, void (* callback)(int32_t r, void* uparam), void* uparam);
+int32_t wlmio_vpe6180_read_all_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint16_t* v, void (* callback)(int32_t r, void* uparam), void* uparam);
+int32_t wlmio_vpe6190_configure_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint8_t ch, uint8_t enable, void (* callback)(int32_t r, void* uparam), void* uparam);
+int32_t wlmio_vpe6190_read_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint8_t ch, uint32_t* v, void (* callback)(int32_t r, void* uparam), void* uparam);
+
+int32_t wlmio_register_list_sync_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint16_t index, char* name);
+int32_t wlmio_register_access_sync_ctx(struct wlmio_ctx* ctx, uint8_t node_id, const char* name, const struct wlmio_register_access* regw, struct wlmio_register_access* regr);
+int32_t wlmio_execute_command_sync_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint16_t command, const void* param, size_t param_len);
+int32_t wlmio_get_node_info_sync_ctx(struct wlmio_ctx* ctx, uint8_t node_id, struct wlmio_node_info* node_info);
+int32_t wlmio_get_register_schema_sync_ctx(struct wlmio_ctx* ctx, uint8_t node_id, struct wlmio_register_schema* schema, size_t capacity);
+int32_t wlmio_node_set_sample_interval_sync_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint16_t sample_interval);
+int32_t wlmio_vpe6010_read_sync_ctx(struct wlmio_ctx* ctx, uint8_t node_id, struct wlmio_vpe6010_input* dst);
+int32_t wlmio_vpe6030_write_sync_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint8_t ch, uint8_t v);
+int32_t wlmio_vpe6040_read_sync_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint8_t ch, uint16_t* v);
+int32_t wlmio_vpe6040_configure_sync_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint8_t ch, uint8_t mode);
+int32_t wlmio_vpe6050_write_sync_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint8_t ch, uint16_t v);
+int32_t wlmio_vpe6050_configure_sync_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint8_t ch, uint8_t mode);
+int32_t wlmio_vpe6060_read_sync_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint8_t ch, uint32_t* v);
+int32_t wlmio_vpe6060_configure_sync_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint8_t ch, uint8_t mode, uint8_t polarity, uint8_t bias);
+int32_t wlmio_vpe6070_write_sync_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint8_t ch, uint16_t v);
+int32_t wlmio_vpe6080_read_sync_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint8_t ch, uint16_t* v);
+int32_t wlmio_vpe6080_configure_sync_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint8_t ch, uint8_t enabled, uint16_t beta, uint16_t t0);
+int32_t wlmio_vpe6090_read_sync_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint8_t ch, uint16_t* v);
+int32_t wlmio_vpe6090_configure_sync_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint8_t ch, uint8_t type);
+int32_t wlmio_vpe6180_read_sync_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint8_t ch, uint16_t* v);
+int32_t wlmio_vpe6190_configure_sync_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint8_t ch, uint8_t enable);
+int32_t wlmio_vpe6190_read_sync_ctx(struct wlmio_ctx* ctx, uint8_t node_id, uint8_t ch, uint32_t* v);
+
 #ifdef __cplusplus
 }
 #endif
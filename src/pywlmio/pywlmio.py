@@ -193,18 +193,21 @@ class Node:
 
     return regr
 
-  async def list_registers(self):
+  async def get_register_schema(self):
     loop = asyncio.get_running_loop()
 
-    names = []
-    for i in range(2 ** 16 - 1):
-      r = await register_list(self.id, i, loop.create_future())
-      if len(r[1]) == 0:
-        break
+    capacity = 256
+    while True:
+      r = await register_schema(self.id, capacity, loop.create_future())
+      if r[0] < 0:
+        raise WlmioInternalError(-r[0])
+      if r[0] <= capacity:
+        return r[1]
 
-      names.append(r[1])
+      capacity = r[0]
 
-    return names
+  async def list_registers(self):
+    return [name for name, reg_type, length in await self.get_register_schema()]
 
 
   async def reboot(self, delay=None):
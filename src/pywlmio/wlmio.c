@@ -4,6 +4,7 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <errno.h>
 #include <threads.h>
 
 #include <wlmio.h>
@@ -312,6 +313,103 @@ exit:
 }
 
 
+// register indices are 16 bit, a node cannot have more registers than this
+#define REGISTER_SCHEMA_CAPACITY_MAX 65536
+
+struct register_schema_param
+{
+  PyObject* future;
+  size_t capacity;
+  struct wlmio_register_schema schema[];
+};
+static void register_schema_callback(const int32_t r, void* const p)
+{
+  const struct register_schema_param* const param = p;
+
+  PyObject* value = NULL;
+  int32_t rv = r;
+
+  if(r >= 0)
+  {
+    const size_t n = (size_t)r < param->capacity ? (size_t)r : param->capacity;
+    value = PyList_New(n);
+    for(size_t i = 0; value && i < n; i += 1)
+    {
+      const struct wlmio_register_schema* const s = &param->schema[i];
+      PyObject* const item = Py_BuildValue("(s,B,H)", s->name, s->type, s->length);
+      if(!item)
+      { Py_CLEAR(value); break; }
+      PyList_SET_ITEM(value, i, item);
+    }
+
+    // the future still has to be resolved, report the failure through it
+    if(!value)
+    {
+      PyErr_Clear();
+      rv = -ENOMEM;
+    }
+  }
+
+  if(!value)
+  {
+    value = Py_None;
+    Py_INCREF(value);
+  }
+
+  PyObject* result = Py_BuildValue("(i,O)", rv, value);
+  Py_DECREF(value);
+  call_soon(param->future, result);
+  Py_DECREF(result);
+
+  Py_DECREF(param->future);
+  free((void*)p);
+}
+
+
+static PyObject* register_schema(PyObject* const self, PyObject* const args)
+{
+  PyObject* result = NULL;
+
+  uint8_t node_id;
+  Py_ssize_t capacity;
+  PyObject* future;
+
+  int32_t r = PyArg_ParseTuple(args, "BnO", &node_id, &capacity, &future);
+  if(r == 0)
+  { goto exit; }
+
+  if(capacity < 0 || capacity > REGISTER_SCHEMA_CAPACITY_MAX)
+  {
+    PyErr_SetString(PyExc_ValueError, "capacity out of range");
+    goto exit;
+  }
+
+  struct register_schema_param* const param = malloc(sizeof(struct register_schema_param) + capacity * sizeof(struct wlmio_register_schema));
+  if(!param)
+  {
+    PyErr_NoMemory();
+    goto exit;
+  }
+
+  param->future = future;
+  param->capacity = capacity;
+  r = wlmio_get_register_schema(node_id, param->schema, capacity, register_schema_callback, param);
+  if(r < 0)
+  {
+    PyErr_SetString(PyExc_SystemError, "register_schema error");
+    free(param);
+    goto exit;
+  }
+
+  Py_INCREF(future);
+  Py_INCREF(future);
+  result = future;
+
+exit:
+  return result;
+}
+
+
 static void execute_command_callback(const int32_t r, void* const p)
 {
   PyObject* const future = p;
@@ -375,6 +473,7 @@ static PyMethodDef wlmio_methods[] =
   {"get_epoll_fd", get_epoll_fd, METH_NOARGS, NULL},
   {"register_access", register_access, METH_VARARGS, NULL},
   {"register_list", register_list, METH_VARARGS, NULL},
+  {"register_schema", register_schema, METH_VARARGS, NULL},
   {"execute_command", execute_command, METH_VARARGS, NULL},
   {NULL, NULL, 0, NULL}
 };
@@ -90,20 +90,14 @@ static int uavcan_send(void)
 {
 	while(1)
 	{
-		const CanardFrame* const txf = canardTxPeek(&canard);
-		if(txf == NULL) { break; }
-
-		canardTxPop(&canard);
-			
 		struct canfd_frame frame;
-		frame.can_id = txf->extended_can_id | 0x80000000UL;
-		frame.len = txf->payload_size;
-		memcpy(frame.data, txf->payload, txf->payload_size);
-			
+		CanardFrame txf;
+		if(canardTxEmit(&canard, &txf, frame.data) <= 0) { break; }
+
+		frame.can_id = txf.extended_can_id | 0x80000000UL;
+		frame.len = txf.payload_size;
+
 		write(can_sock, &frame, sizeof(struct canfd_frame));
-			
-		// free frame after transmission
-		canard.memory_free(&canard, (void*)txf);
 	}
 	
 	return 0;
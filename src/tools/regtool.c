@@ -190,30 +190,48 @@ void print_register(const struct wlmio_register_access* const reg)
 
 void dump_registers(void)
 {
-	uint16_t i = 0;
+	// the schema is usually cached, so only the values need a round trip per register
+	size_t capacity = 64;
+	struct wlmio_register_schema* schema = NULL;
+	int r;
 	while(1)
 	{
-		int r = wlmio_register_list_sync(node_id, i, name);
+		struct wlmio_register_schema* const s = realloc(schema, capacity * sizeof(struct wlmio_register_schema));
+		if(!s)
+		{
+			fprintf(stderr, "Out of memory\n");
+			goto exit;
+		}
+		schema = s;
+
+		r = wlmio_get_register_schema_sync(node_id, schema, capacity);
 		if(r < 0)
 		{
 			fprintf(stderr, "Error listing registers: %d\n", r);
-			break;
+			goto exit;
 		}
-		else if(name[0] == 0) { break; }
+		else if((size_t)r <= capacity) { break; }
+
+		capacity = r;
+	}
+
+	for(int i = 0; i < r; i += 1)
+	{
+		strcpy(name, schema[i].name);
 
 		struct wlmio_register_access value;
-		r = wlmio_register_access_sync(node_id, name, NULL, &value);
-		if(r < 0)
+		const int e = wlmio_register_access_sync(node_id, name, NULL, &value);
+		if(e < 0)
 		{
-			fprintf(stderr, "Error accessing register: %d\n", r);
+			fprintf(stderr, "Error accessing register: %d\n", e);
 			break;
 		}
 		
 		print_register(&value);
-		
-		if(i == UINT16_MAX) { break; }
-		i += 1;
 	}
+
+exit:
+	free(schema);
 }
 
 